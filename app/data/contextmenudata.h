@@ -27,6 +27,22 @@ static const char QUITSYNDOCKACTION[] = "_quit_syndock";
 static const char SECTIONACTION[]= "_syndock_section";
 static const char SEPARATOR1ACTION[] = "_separator1";
 
+//! keys of the context menu snapshot that the dock publishes through dbus
+static const char SNAPSHOTVERSION[] = "version";
+static const char SNAPSHOTMEMORYUSAGE[] = "memoryUsage";
+static const char SNAPSHOTACTIVELAYOUTS[] = "activeLayouts";
+static const char SNAPSHOTCURRENTLAYOUTS[] = "currentLayouts";
+static const char SNAPSHOTACTIONSALWAYSSHOWN[] = "actionsAlwaysShown";
+static const char SNAPSHOTMENULAYOUTS[] = "menuLayouts";
+static const char SNAPSHOTMENULAYOUTICONS[] = "menuLayoutIcons"; /*same order with menu layouts*/
+static const char SNAPSHOTBACKGROUNDICONLAYOUTS[] = "backgroundIconLayouts";
+static const char SNAPSHOTTEMPLATENAMES[] = "templateNames";
+static const char SNAPSHOTTEMPLATEIDS[] = "templateIds"; /*same order with template names*/
+static const char SNAPSHOTVIEWLAYOUT[] = "viewLayout";
+static const char SNAPSHOTVIEWTYPE[] = "viewType";
+static const char SNAPSHOTVIEWISCLONED[] = "viewIsCloned";
+static const char SNAPSHOTVIEWCLONESCOUNT[] = "viewClonesCount";
+
 static QStringList ACTIONSEDITORDER = {LAYOUTSACTION,
                                        PREFERENCESACTION,
                                        QUITSYNDOCKACTION,
@@ -20,7 +20,6 @@
 #include <QLatin1String>
 
 // KDE
-#include <KDirWatch>
 #include <KLocalizedString>
 #include <KMessageBox>
 #include <KNotification>
@@ -57,26 +56,11 @@ Factory::Factory(QObject *parent)
 
     //! track paths for changes
     for(const auto &dir : m_mainPaths) {
-        KDirWatch::self()->addDir(dir);
+        FileWatchRouter::self()->watchDir(this, dir, [&](const QString &path, FileWatchRouter::Changes changes) {
+            onPathChanged(path, changes);
+        });
     }
 
-    connect(KDirWatch::self(), &KDirWatch::dirty, this, [ & ](const QString & path) {
-        if (m_indicatorsPaths.contains(path)) {
-            //! indicator updated
-            reload(path);
-        } else if (m_mainPaths.contains(path)){
-            //! consider indicator addition
-            discoverNewIndicators(path);
-        }
-    });
-
-    connect(KDirWatch::self(), &KDirWatch::deleted, this, [ & ](const QString & path) {
-        if (m_indicatorsPaths.contains(path)) {
-            //! indicator removed
-            removeIndicatorRecords(path);
-        }
-    });
-
     qDebug() << m_plugins["org.kde.syndock.default"].name();
 }
 
@@ -208,12 +192,30 @@ void Factory::discoverNewIndicators(const QString &main)
 
         if (!m_indicatorsPaths.contains(iPath)) {
             m_indicatorsPaths << iPath;
-            KDirWatch::self()->addDir(iPath);
+            m_indicatorsWatchIds[iPath] = FileWatchRouter::self()->watchDir(this, iPath, [&](const QString &path, FileWatchRouter::Changes changes) {
+                onPathChanged(path, changes);
+            });
             reload(iPath);
         }
     }
 }
 
+void Factory::onPathChanged(const QString &path, FileWatchRouter::Changes changes)
+{
+    if (m_indicatorsPaths.contains(path)) {
+        if ((changes & FileWatchRouter::Deleted) && !QFileInfo::exists(path)) {
+            //! indicator removed
+            removeIndicatorRecords(path);
+        } else if ((changes & (FileWatchRouter::Dirty | FileWatchRouter::Created)) && QFileInfo::exists(path)) {
+            //! indicator updated, an atomic replace arrives as Deleted|Created
+            reload(path);
+        }
+    } else if (m_mainPaths.contains(path) && (changes & FileWatchRouter::Dirty)) {
+        //! consider indicator addition
+        discoverNewIndicators(path);
+    }
+}
+
 void Factory::removeIndicatorRecords(const QString &path)
 {
     if (m_indicatorsPaths.contains(path)) {
@@ -229,7 +231,7 @@ void Factory::removeIndicatorRecords(const QString &path)
 
         m_indicatorsPaths.removeAll(path);
 
-        KDirWatch::self()->removeDir(path);
+        FileWatchRouter::self()->unwatch(m_indicatorsWatchIds.take(path));
 
         //! delay informing the removal in case it is just an update
         QTimer::singleShot(1000, [this, pluginId]() {
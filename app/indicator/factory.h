@@ -8,6 +8,7 @@
 
 // local
 #include "../apptypes.h"
+#include "../tools/filewatchrouter.h"
 
 // Qt
 #include <QHash>
@@ -61,6 +62,8 @@ private:
     void removeIndicatorRecords(const QString &path);
     void discoverNewIndicators(const QString &main);
 
+    void onPathChanged(const QString &path, FileWatchRouter::Changes changes);
+
 private:
     QHash<QString, KPluginMetaData> m_plugins;
     QHash<QString, QString> m_pluginUiPaths;
@@ -72,6 +75,7 @@ private:
     //! plugins paths
     QStringList m_mainPaths;
     QStringList m_indicatorsPaths;
+    QHash<QString, int> m_indicatorsWatchIds;
 
     QWidget *m_parentWidget;
 };
@@ -22,6 +22,9 @@
 #include "../view/positioner.h"
 #include "../view/view.h"
 
+// C++
+#include <algorithm>
+
 // Qt
 #include <QDebug>
 #include <QScreen>
@@ -488,28 +491,47 @@ QList<NSE::View *> GenericLayout::sortedLatteViews()
 
 QList<NSE::View *> GenericLayout::sortedLatteViews(QList<NSE::View *> views, QScreen *primaryScreen)
 {
-    QList<NSE::View *> sortedViews = views;
-
-    qDebug() << " -------- ";
-
-    for (int i = 0; i < sortedViews.count(); ++i) {
-        qDebug() << i << ". " << sortedViews[i]->screen()->name() << " - " << sortedViews[i]->location();
-    }
-
     //! sort the views based on screens and edges priorities
     //! views on primary screen have higher priority and
     //! for views in the same screen the priority goes to
     //! Bottom,Left,Top,Right
-    for (int i = 0; i < sortedViews.size(); ++i) {
-        for (int j = 0; j < sortedViews.size() - i - 1; ++j) {
-            if (viewAtLowerScreenPriority(sortedViews[j], sortedViews[j + 1], primaryScreen)
-                    || (sortedViews[j]->screen() == sortedViews[j + 1]->screen()
-                        && viewAtLowerEdgePriority(sortedViews[j], sortedViews[j + 1]))) {
-                NSE::View *temp = sortedViews[j + 1];
-                sortedViews[j + 1] = sortedViews[j];
-                sortedViews[j] = temp;
-            }
+    //! priorities are computed once per view, same priority views keep their order
+    struct PriorityKey {
+        bool onPrimary{false};
+        int screen{-1};
+        int edge{-1};
+        NSE::View *view{nullptr};
+    };
+
+    static const QList<Plasma::Types::Location> edges{Plasma::Types::RightEdge, Plasma::Types::TopEdge,
+                Plasma::Types::LeftEdge, Plasma::Types::BottomEdge};
+
+    const QList<QScreen *> screens = qGuiApp->screens();
+
+    QList<PriorityKey> keys;
+    keys.reserve(views.count());
+
+    for (const auto view : views) {
+        keys << PriorityKey{view->screen() == primaryScreen, (int)screens.indexOf(view->screen()), (int)edges.indexOf(view->location()), view};
+    }
+
+    std::stable_sort(keys.begin(), keys.end(), [](const PriorityKey &a, const PriorityKey &b) {
+        if (a.onPrimary != b.onPrimary) {
+            return a.onPrimary;
+        }
+
+        if (a.screen != b.screen) {
+            return a.screen > b.screen;
         }
+
+        return a.edge > b.edge;
+    });
+
+    QList<NSE::View *> sortedViews;
+    sortedViews.reserve(keys.count());
+
+    for (const auto &key : keys) {
+        sortedViews << key.view;
     }
 
     NSE::View *highestPriorityView{nullptr};
@@ -526,12 +548,6 @@ QList<NSE::View *> GenericLayout::sortedLatteViews(QList<NSE::View *> views, QSc
         sortedViews.prepend(highestPriorityView);
     }
 
-    qDebug() << " -------- sorted -----";
-
-    for (int i = 0; i < sortedViews.count(); ++i) {
-        qDebug() << i << ". " << sortedViews[i]->isPreferredForShortcuts() << " - " << sortedViews[i]->screen()->name() << " - " << sortedViews[i]->location();
-    }
-
     return sortedViews;
 }
 
@@ -0,0 +1,391 @@
+/* This file is a part of the Atmo desktop experience's SynDock project for SynOS.
+ * Copyright (C) 2026 Syndromatic Ltd. All rights reserved
+ * Designed by Kavish Krishnakumar in Manchester.
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+#include "catalogue.h"
+
+// local
+#include "../layout/abstractlayout.h"
+
+// Qt
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QStandardPaths>
+
+// KDE
+#include <KConfig>
+#include <KConfigGroup>
+
+//! increase when the stored entries change meaning, older indexes are discarded
+#define CATALOGUEVERSION 1
+
+namespace NSE {
+namespace Layouts {
+
+namespace {
+
+bool boolValue(const QHash<QString, QString> &entries, const QString &key, const bool &defaultValue)
+{
+    if (!entries.contains(key)) {
+        return defaultValue;
+    }
+
+    const QString value = entries[key].toLower();
+    return (value == QLatin1String("true") || value == QLatin1String("on") || value == QLatin1String("yes") || value == QLatin1String("1"));
+}
+
+int intValue(const QHash<QString, QString> &entries, const QString &key, const int &defaultValue)
+{
+    bool ok{false};
+    const int value = entries.value(key).toInt(&ok);
+    return ok ? value : defaultValue;
+}
+
+}
+
+Catalogue::Catalogue()
+{
+}
+
+Catalogue::~Catalogue()
+{
+    save();
+}
+
+QString Catalogue::indexFile() const
+{
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/layoutscatalogue";
+}
+
+bool Catalogue::isCurrent(const Entry &entry, const QFileInfo &info)
+{
+    return (entry.size == info.size() && entry.modified == info.lastModified().toMSecsSinceEpoch());
+}
+
+void Catalogue::load()
+{
+    if (m_isLoaded) {
+        return;
+    }
+
+    m_isLoaded = true;
+
+    KConfig index(indexFile(), KConfig::SimpleConfig);
+
+    if (KConfigGroup(&index, "General").readEntry("version", 0) != CATALOGUEVERSION) {
+        return;
+    }
+
+    KConfigGroup layouts(&index, "Layouts");
+
+    for (const auto &file : layouts.groupList()) {
+        KConfigGroup group = layouts.group(file);
+
+        Entry entry;
+        entry.size = group.readEntry("size", (qint64)-1);
+        entry.modified = group.readEntry("modified", (qint64)-1);
+        entry.issuesCounted = group.readEntry("issuesCounted", false);
+
+        Data::Layout &data = entry.data;
+        data.id = file;
+        data.name = Layout::AbstractLayout::layoutName(file);
+        data.icon = group.readEntry("icon", QString());
+        data.color = group.readEntry("color", QString());
+        data.background = group.readEntry("background", QString());
+        data.textColor = group.readEntry("textColor", QString());
+        data.lastUsedActivity = group.readEntry("lastUsedActivity", QString());
+        data.schemeFile = group.readEntry("schemeFile", QString(Data::Layout::DEFAULTSCHEMEFILE));
+        data.isShownInMenu = group.readEntry("isShownInMenu", false);
+        data.hasDisabledBorders = group.readEntry("hasDisabledBorders", false);
+        data.popUpMargin = group.readEntry("popUpMargin", -1);
+        data.activities = group.readEntry("activities", QStringList());
+        data.errors = group.readEntry("errors", 0);
+        data.warnings = group.readEntry("warnings", 0);
+        data.backgroundStyle = static_cast<Layout::BackgroundStyle>(group.readEntry("backgroundStyle", (int)Layout::ColorBackgroundStyle));
+
+        m_entries[file] = entry;
+    }
+}
+
+void Catalogue::save()
+{
+    if (!m_isDirty) {
+        return;
+    }
+
+    m_isDirty = false;
+
+    QDir().mkpath(QFileInfo(indexFile()).absolutePath());
+    KConfig index(indexFile(), KConfig::SimpleConfig);
+
+    KConfigGroup(&index, "General").writeEntry("version", CATALOGUEVERSION);
+
+    KConfigGroup layouts(&index, "Layouts");
+    layouts.deleteGroup();
+
+    for (auto it = m_entries.constBegin(); it != m_entries.constEnd(); ++it) {
+        KConfigGroup group = layouts.group(it.key());
+        const Data::Layout &data = it.value().data;
+
+        group.writeEntry("size", it.value().size);
+        group.writeEntry("modified", it.value().modified);
+        group.writeEntry("issuesCounted", it.value().issuesCounted);
+        group.writeEntry("icon", data.icon);
+        group.writeEntry("color", data.color);
+        group.writeEntry("background", data.background);
+        group.writeEntry("textColor", data.textColor);
+        group.writeEntry("lastUsedActivity", data.lastUsedActivity);
+        group.writeEntry("schemeFile", data.schemeFile);
+        group.writeEntry("isShownInMenu", data.isShownInMenu);
+        group.writeEntry("hasDisabledBorders", data.hasDisabledBorders);
+        group.writeEntry("popUpMargin", data.popUpMargin);
+        group.writeEntry("activities", data.activities);
+        group.writeEntry("errors", data.errors);
+        group.writeEntry("warnings", data.warnings);
+        group.writeEntry("backgroundStyle", (int)data.backgroundStyle);
+    }
+
+    index.sync();
+}
+
+Data::Layout Catalogue::layout(const QString &file)
+{
+    load();
+
+    QFileInfo info(file);
+
+    if (!info.exists()) {
+        if (m_entries.remove(file) > 0) {
+            m_isDirty = true;
+        }
+
+        return Data::Layout();
+    }
+
+    Entry &entry = m_entries[file];
+
+    if (!isCurrent(entry, info)) {
+        entry.size = info.size();
+        entry.modified = info.lastModified().toMSecsSinceEpoch();
+        entry.issuesCounted = false;
+        entry.data = parseLayoutSettings(file);
+        m_isDirty = true;
+    }
+
+    Data::Layout data = entry.data;
+    //! permissions changes do not touch the modification time
+    data.isLocked = !info.isWritable();
+
+    return data;
+}
+
+void Catalogue::retain(const QStringList &files)
+{
+    load();
+
+    for (auto it = m_entries.begin(); it != m_entries.end();) {
+        if (!files.contains(it.key())) {
+            it = m_entries.erase(it);
+            m_isDirty = true;
+        } else {
+            ++it;
+        }
+    }
+}
+
+QStringList Catalogue::uncountedLayouts() const
+{
+    QStringList files;
+
+    for (auto it = m_entries.constBegin(); it != m_entries.constEnd(); ++it) {
+        if (!it.value().issuesCounted) {
+            files << it.key();
+        }
+    }
+
+    return files;
+}
+
+void Catalogue::setIssues(const QString &file, const int &errors, const int &warnings)
+{
+    if (!m_entries.contains(file)) {
+        return;
+    }
+
+    Entry &entry = m_entries[file];
+
+    if (entry.issuesCounted && entry.data.errors == errors && entry.data.warnings == warnings) {
+        return;
+    }
+
+    entry.issuesCounted = true;
+    entry.data.errors = errors;
+    entry.data.warnings = warnings;
+    m_isDirty = true;
+}
+
+QString Catalogue::unescaped(const QByteArray &value)
+{
+    //! KConfig ini escaping, \s \t \n \r \\ and \xNN
+    if (!value.contains('\\')) {
+        return QString::fromUtf8(value);
+    }
+
+    QByteArray result;
+    result.reserve(value.size());
+
+    for (int i = 0; i < value.size(); ++i) {
+        const char c = value.at(i);
+
+        if (c != '\\' || i+1 >= value.size()) {
+            result += c;
+            continue;
+        }
+
+        const char next = value.at(++i);
+
+        switch (next) {
+        case 's': result += ' '; break;
+        case 't': result += '\t'; break;
+        case 'n': result += '\n'; break;
+        case 'r': result += '\r'; break;
+        case '\\': result += '\\'; break;
+        case 'x':
+            if (i+2 < value.size()) {
+                bool ok{false};
+                const char hex = static_cast<char>(value.mid(i+1, 2).toInt(&ok, 16));
+
+                if (ok) {
+                    result += hex;
+                    i += 2;
+                    break;
+                }
+            }
+            result += "\\x";
+            break;
+        default:
+            //! list separators are resolved by listValue()
+            result += '\\';
+            result += next;
+            break;
+        }
+    }
+
+    return QString::fromUtf8(result);
+}
+
+QStringList Catalogue::listValue(const QString &value)
+{
+    QStringList list;
+
+    if (value.isEmpty()) {
+        return list;
+    }
+
+    QString item;
+
+    for (int i = 0; i < value.size(); ++i) {
+        const QChar c = value.at(i);
+
+        if (c == QLatin1Char('\\') && i+1 < value.size()) {
+            item += value.at(++i);
+        } else if (c == QLatin1Char(',')) {
+            list << item;
+            item.clear();
+        } else {
+            item += c;
+        }
+    }
+
+    list << item;
+    return list;
+}
+
+Data::Layout Catalogue::parseLayoutSettings(const QString &file)
+{
+    Data::Layout data;
+    data.id = file;
+    data.name = Layout::AbstractLayout::layoutName(file);
+
+    QFile layoutFile(file);
+
+    if (!layoutFile.open(QIODevice::ReadOnly)) {
+        return data;
+    }
+
+    //! groups are stored alphabetically, so [LayoutSettings] is found after the
+    //! containments. Their lines are only checked for a group header, never parsed
+    QHash<QString, QString> entries;
+    bool inLayoutSettings{false};
+
+    while (!layoutFile.atEnd()) {
+        const QByteArray line = layoutFile.readLine().trimmed();
+
+        if (line.startsWith('[')) {
+            if (inLayoutSettings) {
+                break;
+            }
+
+            inLayoutSettings = (line == QByteArrayLiteral("[LayoutSettings]"));
+            continue;
+        }
+
+        if (!inLayoutSettings || line.isEmpty() || line.startsWith('#')) {
+            continue;
+        }
+
+        const int separator = line.indexOf('=');
+
+        if (separator <= 0) {
+            continue;
+        }
+
+        QByteArray key = line.left(separator).trimmed();
+        const int options = key.indexOf('[');
+
+        if (options > 0) {
+            key.truncate(options);
+        }
+
+        entries[QString::fromUtf8(key)] = unescaped(line.mid(separator+1).trimmed());
+    }
+
+    //! same defaults and fallbacks with AbstractLayout/CentralLayout::loadConfig()
+    data.icon = entries.value("icon");
+    data.color = entries.value("color", QStringLiteral("blue"));
+    data.lastUsedActivity = entries.value("lastUsedActivity");
+    data.popUpMargin = intValue(entries, "popUpMargin", -1);
+    data.isShownInMenu = boolValue(entries, "showInMenu", false);
+    data.hasDisabledBorders = boolValue(entries, "disableBordersForMaximizedWindows", false);
+    data.activities = listValue(entries.value("activities"));
+    data.backgroundStyle = static_cast<Layout::BackgroundStyle>(intValue(entries, "backgroundStyle", (int)Layout::ColorBackgroundStyle));
+
+    QString schemeFile = entries.value("schemeFile", QString(Data::Layout::DEFAULTSCHEMEFILE));
+
+    if (schemeFile.startsWith("~")) {
+        schemeFile.remove(0, 1);
+        schemeFile = QDir::homePath() + schemeFile;
+    }
+
+    data.schemeFile = schemeFile.isEmpty() || !QFileInfo(schemeFile).exists() ? Data::Layout::DEFAULTSCHEMEFILE : schemeFile;
+
+    const QString deprecatedBackground = entries.value("background");
+
+    if (deprecatedBackground.startsWith("/")) {
+        //! migrated to customBackground the first time the layout is loaded
+        data.background = deprecatedBackground;
+        data.textColor = entries.value("textColor");
+        data.backgroundStyle = Layout::PatternBackgroundStyle;
+    } else {
+        data.background = entries.value("customBackground");
+        data.textColor = entries.value("customTextColor");
+    }
+
+    return data;
+}
+
+}
+}
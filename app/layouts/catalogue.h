@@ -0,0 +1,71 @@
+/* This file is a part of the Atmo desktop experience's SynDock project for SynOS.
+ * Copyright (C) 2026 Syndromatic Ltd. All rights reserved
+ * Designed by Kavish Krishnakumar in Manchester.
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+#ifndef LAYOUTSCATALOGUE_H
+#define LAYOUTSCATALOGUE_H
+
+// local
+#include "../data/layoutdata.h"
+
+// Qt
+#include <QByteArray>
+#include <QFileInfo>
+#include <QHash>
+#include <QString>
+#include <QStringList>
+
+namespace NSE {
+namespace Layouts {
+
+//! Catalogue provides the Data::Layout of user layout files without creating
+//! layout objects. Only the [LayoutSettings] group of each file is parsed and the
+//! results are kept in a persistent index keyed by file path, size and modification
+//! time, so only files that changed since the last run are read again.
+//!
+//! Errors and warnings need the full containments tree, they are counted later
+//! through uncountedLayouts()/setIssues() and stored in the index as well.
+class Catalogue
+{
+public:
+    Catalogue();
+    ~Catalogue();
+
+    Data::Layout layout(const QString &file);
+    //! forget indexed files that are not part of the given list any more
+    void retain(const QStringList &files);
+
+    QStringList uncountedLayouts() const;
+    void setIssues(const QString &file, const int &errors, const int &warnings);
+
+    void save();
+
+private:
+    struct Entry {
+        qint64 size{-1};
+        qint64 modified{-1};
+        bool issuesCounted{false};
+        Data::Layout data;
+    };
+
+    void load();
+    QString indexFile() const;
+
+    static bool isCurrent(const Entry &entry, const QFileInfo &info);
+    static Data::Layout parseLayoutSettings(const QString &file);
+    static QString unescaped(const QByteArray &value);
+    static QStringList listValue(const QString &value);
+
+private:
+    bool m_isLoaded{false};
+    bool m_isDirty{false};
+
+    QHash<QString, Entry> m_entries;
+};
+
+}
+}
+
+#endif
@@ -26,6 +26,7 @@
 #include <KArchive/KTar>
 #include <KArchive/KArchiveEntry>
 #include <KArchive/KArchiveDirectory>
+#include <KArchive/KArchiveFile>
 #include <KConfigGroup>
 #include <KLocalizedString>
 #include <KNotification>
@@ -40,6 +41,59 @@ enum SessionType
 namespace NSE {
 namespace Layouts {
 
+namespace {
+
+//! reads the "version" entry of a group from an rc file inside an archive,
+//! the entry is streamed from the archive and reading stops at the group end.
+//! returns -1 when the archive does not contain the rc file
+int archivedConfigVersion(const KArchiveDirectory *directory, const QString &entryName, const QByteArray &groupName)
+{
+    const KArchiveFile *rcEntry = directory ? directory->file(entryName) : nullptr;
+
+    if (!rcEntry) {
+        return -1;
+    }
+
+    QIODevice *device = rcEntry->createDevice();
+
+    if (!device) {
+        return -1;
+    }
+
+    const QByteArray groupHeader = "[" + groupName + "]";
+    bool inGroup{false};
+    int version{1};
+
+    while (!device->atEnd()) {
+        const QByteArray line = device->readLine().trimmed();
+
+        if (line.startsWith('[')) {
+            if (inGroup) {
+                break;
+            }
+
+            inGroup = (line == groupHeader);
+            continue;
+        }
+
+        if (inGroup && line.startsWith("version")) {
+            const int separator = line.indexOf('=');
+
+            if (separator > 0 && line.left(separator).trimmed() == "version") {
+                bool ok{false};
+                const int value = line.mid(separator+1).trimmed().toInt(&ok);
+                version = ok ? value : version;
+                break;
+            }
+        }
+    }
+
+    delete device;
+    return version;
+}
+
+}
+
 Importer::Importer(QObject *parent)
     : QObject(parent)
 {
@@ -451,7 +505,8 @@ Importer::LatteFileVersion Importer::fileVersion(QString file)
         return Importer::UnknownFileType;
     }
 
-    QTemporaryDir archiveTempDir;
+    //! only the archive index and the small rc entries are read, nothing is extracted
+    const KArchiveDirectory *rootDir = archive.directory();
 
     bool version1rc = false;
     bool version1applets = false;
@@ -460,31 +515,18 @@ Importer::LatteFileVersion Importer::fileVersion(QString file)
     bool version2LatteDir = false;
     bool version2layout = false;
 
-    archive.directory()->copyTo(archiveTempDir.path());
-
-
     //rc file
-    QString rcFile(archiveTempDir.path() + "/lattedockrc");
+    int version = archivedConfigVersion(rootDir, QStringLiteral("lattedockrc"), "UniversalSettings");
 
-    if (QFile(rcFile).exists()) {
-        KSharedConfigPtr lConfig = KSharedConfig::openConfig(rcFile);
-        KConfigGroup universalGroup = KConfigGroup(lConfig, "UniversalSettings");
-        int version = universalGroup.readEntry("version", 1);
-
-        if (version == 1) {
-            version1rc = true;
-        } else if (version == 2) {
-            version2rc = true;
-        }
+    if (version == 1) {
+        version1rc = true;
+    } else if (version == 2) {
+        version2rc = true;
     }
 
     //applets file
-    QString appletsFile(archiveTempDir.path() + "/lattedock-appletsrc");
-
-    if (QFile(appletsFile).exists() && version1rc) {
-        KSharedConfigPtr lConfig = KSharedConfig::openConfig(appletsFile);
-        KConfigGroup generalGroup = KConfigGroup(lConfig, "LayoutSettings");
-        int version = generalGroup.readEntry("version", 1);
+    if (version1rc) {
+        version = archivedConfigVersion(rootDir, QStringLiteral("lattedock-appletsrc"), "LayoutSettings");
 
         if (version == 1) {
             version1applets = true;
@@ -494,9 +536,9 @@ Importer::LatteFileVersion Importer::fileVersion(QString file)
     }
 
     //latte directory
-    QString latteDir(archiveTempDir.path() + "/latte");
+    const KArchiveEntry *latteDir = rootDir ? rootDir->entry(QStringLiteral("latte")) : nullptr;
 
-    if (QDir(latteDir).exists()) {
+    if (latteDir && latteDir->isDirectory()) {
         version2LatteDir = true;
     }
 
@@ -391,11 +391,10 @@ void Manager::clearUnloadedContainmentsFromLinkedFile(QStringList containmentsId
 
     for (const auto &conId : containmentsIds) {
         qDebug() << "unloads ::: " << conId;
-        KConfigGroup containment = containments.group(conId);
-        containment.deleteGroup();
-        containment.sync();
+        containments.group(conId).deleteGroup();
     }
 
+    //! one write for all unloaded containments
     containments.sync();
 }
 
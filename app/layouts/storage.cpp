@@ -22,6 +22,7 @@
 #include <QFile>
 #include <QFileInfo>
 #include <QLatin1String>
+#include <QSet>
 
 // KDE
 #include <KConfigGroup>
@@ -539,10 +540,8 @@ void Storage::syncToLayoutFile(const Layout::GenericLayout *layout, bool removeL
         return;
     }
 
-    KSharedConfigPtr filePtr = KSharedConfig::openConfig(layout->file());
-
-    KConfigGroup oldContainments = KConfigGroup(filePtr, "Containments");
-    oldContainments.deleteGroup();
+    WriteSession session(layout->file());
+    session.removeContainments();
 
     qDebug() << " LAYOUT :: " << layout->name() << " is syncing its original file.";
 
@@ -551,18 +550,11 @@ void Storage::syncToLayoutFile(const Layout::GenericLayout *layout, bool removeL
             containment->config().writeEntry("layoutId", "");
         }
 
-        KConfigGroup newGroup = oldContainments.group(QString::number(containment->id()));
-        containment->config().copyTo(&newGroup);
-
-        if (!removeLayoutId) {
-            newGroup.writeEntry("layoutId", "");
-        }
-
-        newGroup.sync();
+        session.copyContainment(containment->config(), QString::number(containment->id()));
     }
 
-    filePtr->reparseConfiguration();
-    removeAllClonedViews(layout->file());
+    removeAllClonedViews(session);
+    session.commit();
 }
 
 void Storage::moveToLayoutFile(const QString &layoutName)
@@ -578,29 +570,25 @@ void Storage::moveToLayoutFile(const QString &layoutName)
         return;
     }
 
-    KSharedConfigPtr layoutFilePtr = KSharedConfig::openConfig(layoutFilePath);
-    KConfigGroup singleContainments = KConfigGroup(layoutFilePtr, "Containments");
-    singleContainments.deleteGroup();
+    WriteSession singleSession(layoutFilePath);
+    singleSession.removeContainments();
 
-    KSharedConfigPtr multiFilePtr = KSharedConfig::openConfig(linkedFilePath);
-    KConfigGroup multiContainments = KConfigGroup(multiFilePtr, "Containments");
+    WriteSession multiSession(linkedFilePath);
+    KConfigGroup multiContainments = multiSession.containments();
 
     for(const auto &cId : multiContainments.groupList()) {
         QString cname = multiContainments.group(cId).readEntry("layoutId", QString());
 
         if (!cname.isEmpty() && cname == layoutName) {
-            multiContainments.group(cId).writeEntry("layoutId", "");
-            KConfigGroup singleGroup = singleContainments.group(cId);
-            multiContainments.group(cId).copyTo(&singleGroup);
-            singleGroup.writeEntry("layoutId", "");
-            singleGroup.sync();
-
-            multiContainments.group(cId).deleteGroup();
+            singleSession.copyContainment(multiContainments.group(cId), cId);
+            multiSession.removeContainment(cId);
         }
     }
 
-    layoutFilePtr->reparseConfiguration();
-    removeAllClonedViews(layoutFilePath);
+    removeAllClonedViews(singleSession);
+
+    singleSession.commit();
+    multiSession.commit();
 }
 
 QList<Plasma::Containment *> Storage::importLayoutFile(const Layout::GenericLayout *layout, QString file)
@@ -882,8 +870,8 @@ bool Storage::hasDifferentAppletsWithSameId(const Layout::GenericLayout *layout,
     error.name = s_knownErrors[Data::Error::APPLETSWITHSAMEID].name;
 
     if (layout->isActive()) { // active layout
-        QStringList registeredapplets;
-        QStringList conflictedapplets;
+        QSet<QString> registeredapplets;
+        QSet<QString> conflictedapplets;
 
         //! split ids to normal registered and conflicted
         for (const auto containment : *layout->containments()) {
@@ -925,8 +913,8 @@ bool Storage::hasDifferentAppletsWithSameId(const Layout::GenericLayout *layout,
         KSharedConfigPtr lfile = KSharedConfig::openConfig(layout->file());
         KConfigGroup containmentsEntries = KConfigGroup(lfile, "Containments");
 
-        QStringList registeredapplets;
-        QStringList conflictedapplets;
+        QSet<QString> registeredapplets;
+        QSet<QString> conflictedapplets;
 
         //! split ids to normal registered and conflicted
         for (const auto &cid : containmentsEntries.groupList()) {
@@ -971,8 +959,8 @@ bool Storage::hasAppletsAndContainmentsWithSameId(const Layout::GenericLayout *l
     warning.name = s_knownErrors[Data::Error::APPLETANDCONTAINMENTWITHSAMEID].name;
 
     if (layout->isActive()) { // active layout
-        QStringList registeredcontainments;
-        QStringList conflicted;
+        QSet<QString> registeredcontainments;
+        QSet<QString> conflicted;
 
         //! discover normal containment ids
         for (const auto containment : *layout->containments()) {
@@ -1034,8 +1022,8 @@ bool Storage::hasAppletsAndContainmentsWithSameId(const Layout::GenericLayout *l
         KSharedConfigPtr lfile = KSharedConfig::openConfig(layout->file());
         KConfigGroup containmentsEntries = KConfigGroup(lfile, "Containments");
 
-        QStringList registeredcontainments;
-        QStringList conflicted;
+        QSet<QString> registeredcontainments;
+        QSet<QString> conflicted;
 
         //! discover normal containment ids
         for (const auto &cid : containmentsEntries.groupList()) {
@@ -1487,8 +1475,14 @@ bool Storage::isClonedView(const KConfigGroup &containmentGroup) const
 
 void Storage::removeAllClonedViews(const QString &filepath)
 {
-    KSharedConfigPtr lFile = KSharedConfig::openConfig(filepath);
-    KConfigGroup containmentGroups = KConfigGroup(lFile, "Containments");
+    WriteSession session(filepath);
+    removeAllClonedViews(session);
+    session.commit();
+}
+
+void Storage::removeAllClonedViews(WriteSession &session)
+{
+    KConfigGroup containmentGroups = session.containments();
 
     QList<Data::View> clones;
 
@@ -1503,12 +1497,12 @@ void Storage::removeAllClonedViews(const QString &filepath)
     }
 
     if (clones.count()>0) {
-        qDebug() << "org.kde.layout :: Removing clones from file: " << filepath;
+        qDebug() << "org.kde.layout :: Removing clones from file: " << session.file();
     }
 
     for (const auto &clonedata : clones) {
         qDebug() << "org.kde.layout :: Removing clone:" << clonedata.id << " and its subcontainments:" << clonedata.subcontainments;
-        removeView(filepath, clonedata);
+        removeView(session, clonedata);
     }
 }
 
@@ -1662,33 +1656,30 @@ void Storage::updateView(const Layout::GenericLayout *layout, const Data::View &
 }
 
 void Storage::removeView(const QString &filepath, const Data::View &viewData)
+{
+    WriteSession session(filepath);
+    removeView(session, viewData);
+    session.commit();
+}
+
+void Storage::removeView(WriteSession &session, const Data::View &viewData)
 {
     if (!viewData.isValid()) {
         return;
     }
 
-    removeContainment(filepath, viewData.id);
+    session.removeContainment(viewData.id);
 
     for (int i=0; i<viewData.subcontainments.rowCount(); ++i) {
-        removeContainment(filepath, viewData.subcontainments[i].id);
+        session.removeContainment(viewData.subcontainments[i].id);
     }
 }
 
 void Storage::removeContainment(const QString &filepath, const QString &containmentId)
 {
-    if (containmentId.isEmpty()) {
-        return;
-    }
-
-    KSharedConfigPtr lFile = KSharedConfig::openConfig(filepath);
-    KConfigGroup containmentGroups = KConfigGroup(lFile, "Containments");
-
-    if (!containmentGroups.group(containmentId).exists()) {
-        return;
-    }
-
-    containmentGroups.group(containmentId).deleteGroup();
-    lFile->reparseConfiguration();
+    WriteSession session(filepath);
+    session.removeContainment(containmentId);
+    session.commit();
 }
 
 QStringList Storage::storedLayoutsInMultipleFile()
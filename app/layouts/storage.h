@@ -12,12 +12,14 @@
 #include "../data/genericdata.h"
 #include "../data/generictable.h"
 #include "../data/viewstable.h"
+#include "writesession.h"
 
 // Qt
 #include <QTemporaryDir>
 
 // KDE
 #include <KConfigGroup>
+#include <KSharedConfig>
 
 // Plasma
 #include <Plasma/Applet>
@@ -60,6 +62,7 @@ public:
     bool isClonedView(const Plasma::Containment *containment) const;
     bool isClonedView(const KConfigGroup &containmentGroup) const;
     void removeAllClonedViews(const QString &filepath);
+    void removeAllClonedViews(WriteSession &session);
 
     int subContainmentId(const KConfigGroup &appletGroup) const;
 
@@ -73,6 +76,7 @@ public:
 
     Data::View newView(const Layout::GenericLayout *destination, const Data::View &nextViewData);
     void removeView(const QString &filepath, const Data::View &viewData);
+    void removeView(WriteSession &session, const Data::View &viewData);
     void updateView(const Layout::GenericLayout *layout, const Data::View &viewData);
     void updateView(KConfigGroup viewGroup, const Data::View &viewData);
     QString storedView(const Layout::GenericLayout *layout, const int &containmentId); //returns temp filepath containing all view data
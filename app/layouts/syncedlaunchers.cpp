@@ -22,6 +22,25 @@
 namespace NSE {
 namespace Layouts {
 
+namespace {
+//! the signatures of SyncedLaunchers::SyncedMethod
+const char *const SYNCEDMETHODS[] = {
+    "addSyncedLauncher(QVariant,QVariant)",
+    "removeSyncedLauncher(QVariant,QVariant)",
+    "addSyncedLauncherToActivity(QVariant,QVariant,QVariant)",
+    "removeSyncedLauncherFromActivity(QVariant,QVariant,QVariant)",
+    "dropSyncedUrls(QVariant,QVariant)",
+    "validateSyncedLaunchersOrder(QVariant,QVariant)"
+};
+
+//! client properties that the registry indexes
+const char *const INDEXEDPROPERTIES[] = {
+    "clientId",
+    "layoutName",
+    "syncedGroupId"
+};
+}
+
 SyncedLaunchers::SyncedLaunchers(QObject *parent)
     : QObject(parent)
 {
@@ -40,6 +59,34 @@ void SyncedLaunchers::addAbilityClient(QQuickItem *client)
 
     m_clients << client;
 
+    ClientEntry entry;
+    const QMetaObject *metaObject = client->metaObject();
+
+    for (int i = 0; i < SyncedMethodsCount; ++i) {
+        int methodIndex = metaObject->indexOfMethod(SYNCEDMETHODS[i]);
+
+        if (methodIndex == -1) {
+            qDebug() << "Launchers Syncer Ability:" << SYNCEDMETHODS[i] << "was NOT found...";
+            continue;
+        }
+
+        entry.methods[i] = metaObject->method(methodIndex);
+    }
+
+    m_entries[client] = entry;
+    indexClient(client);
+
+    //! keep the registry up to date when the indexed properties of the client change
+    const QMetaMethod updateSlot = staticMetaObject.method(staticMetaObject.indexOfSlot("onClientPropertiesChanged()"));
+
+    for (const auto propertyName : INDEXEDPROPERTIES) {
+        int propertyIndex = metaObject->indexOfProperty(propertyName);
+
+        if (propertyIndex != -1 && metaObject->property(propertyIndex).hasNotifySignal()) {
+            connect(client, metaObject->property(propertyIndex).notifySignal(), this, updateSlot);
+        }
+    }
+
     connect(client, &QObject::destroyed, this, &SyncedLaunchers::removeClientObject);
 }
 
@@ -49,43 +96,96 @@ void SyncedLaunchers::removeAbilityClient(QQuickItem *client)
         return;
     }
 
-    disconnect(client, &QObject::destroyed, this, &SyncedLaunchers::removeClientObject);
+    disconnect(client, nullptr, this, nullptr);
+    unindexClient(client);
+    m_entries.remove(client);
     m_clients.removeAll(client);
 }
 
 void SyncedLaunchers::removeClientObject(QObject *obj)
 {
-    QQuickItem *item = qobject_cast<QQuickItem *>(obj);
+    //! the client is already partially destroyed, it must be treated only as a key
+    QQuickItem *item = static_cast<QQuickItem *>(obj);
 
-    if (item) {
-        removeAbilityClient(item);
+    if (item && m_clients.contains(item)) {
+        unindexClient(item);
+        m_entries.remove(item);
+        m_clients.removeAll(item);
     }
 }
 
-QQuickItem *SyncedLaunchers::client(const int &id)
+void SyncedLaunchers::onClientPropertiesChanged()
 {
-    if (id <= 0) {
-        return nullptr;
+    QQuickItem *item = qobject_cast<QQuickItem *>(sender());
+
+    if (!item || !m_entries.contains(item)) {
+        return;
     }
 
-    for(const auto client: m_clients) {
-        int clientid = client->property("clientId").toInt();
-        if (clientid == id) {
-            return client;
+    unindexClient(item);
+    indexClient(item);
+}
+
+void SyncedLaunchers::indexClient(QQuickItem *client)
+{
+    ClientEntry &entry = m_entries[client];
+    entry.id = client->property("clientId").toInt();
+    entry.layoutName = client->property("layoutName").toString();
+    entry.groupId = client->property("syncedGroupId").toString();
+
+    if (entry.id > 0) {
+        m_clientsById[entry.id] = client;
+    }
+
+    m_clientsByGroupId[entry.groupId] << client;
+}
+
+void SyncedLaunchers::unindexClient(QQuickItem *client)
+{
+    auto entry = m_entries.constFind(client);
+
+    if (entry == m_entries.constEnd()) {
+        return;
+    }
+
+    auto byId = m_clientsById.find(entry->id);
+
+    if (byId != m_clientsById.end() && byId.value() == client) {
+        m_clientsById.erase(byId);
+    }
+
+    auto group = m_clientsByGroupId.find(entry->groupId);
+
+    if (group != m_clientsByGroupId.end()) {
+        group->removeAll(client);
+
+        if (group->isEmpty()) {
+            m_clientsByGroupId.erase(group);
         }
     }
+}
 
-    return nullptr;
+QQuickItem *SyncedLaunchers::client(const int &id)
+{
+    if (id <= 0) {
+        return nullptr;
+    }
+
+    return m_clientsById.value(id, nullptr);
 }
 
 QList<QQuickItem *> SyncedLaunchers::clients(QString layoutName, QString groupId)
 {
+    const QList<QQuickItem *> groupClients = m_clientsByGroupId.value(groupId);
+
+    if (layoutName.isEmpty()) {
+        return groupClients;
+    }
+
     QList<QQuickItem *> items;
 
-    for(const auto client: m_clients) {
-        QString cLayoutName = layoutName.isEmpty() ? QString() : client->property("layoutName").toString();
-        QString gid = client->property("syncedGroupId").toString();
-        if (cLayoutName == layoutName && gid == groupId) {
+    for(const auto client: groupClients) {
+        if (m_entries.value(client).layoutName == layoutName) {
             items << client;
         }
     }
@@ -101,7 +201,7 @@ QList<QQuickItem *> SyncedLaunchers::clients(QString layoutName, uint senderId,
         //! on its own, single taskmanager
         auto c = client(senderId);
         if (c) {
-            temclients << client(senderId);
+            temclients << c;
         }
     } else {
         temclients << clients(layoutName, launcherGroupId);
@@ -110,44 +210,37 @@ QList<QQuickItem *> SyncedLaunchers::clients(QString layoutName, uint senderId,
     return temclients;
 }
 
-void SyncedLaunchers::addLauncher(QString layoutName, uint senderId, int launcherGroup, QString launcherGroupId, QString launcher)
+void SyncedLaunchers::invoke(const QList<QQuickItem *> &clients, SyncedMethod method, const QVariant &arg1, const QVariant &arg2, const QVariant &arg3)
 {
-    Types::LaunchersGroup group = static_cast<Types::LaunchersGroup>(launcherGroup);
-    QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
-
-    for(const auto c : clients(lName, senderId, group, launcherGroupId)) {
-        if (auto *metaObject = c->metaObject()) {
-            int methodIndex = metaObject->indexOfMethod("addSyncedLauncher(QVariant,QVariant)");
+    for(const auto c : clients) {
+        const QMetaMethod &metaMethod = m_entries[c].methods[method];
 
-            if (methodIndex == -1) {
-                qDebug() << "Launchers Syncer Ability: addSyncedLauncher(QVariant,QVariant) was NOT found...";
-                continue;
-            }
+        if (!metaMethod.isValid()) {
+            continue;
+        }
 
-            QMetaMethod method = metaObject->method(methodIndex);
-            method.invoke(c, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher));
+        if (metaMethod.parameterCount() == 3) {
+            metaMethod.invoke(c, Q_ARG(QVariant, arg1), Q_ARG(QVariant, arg2), Q_ARG(QVariant, arg3));
+        } else {
+            metaMethod.invoke(c, Q_ARG(QVariant, arg1), Q_ARG(QVariant, arg2));
         }
     }
 }
 
-void SyncedLaunchers::removeLauncher(QString layoutName, uint senderId, int launcherGroup, QString launcherGroupId, QString launcher)
+void SyncedLaunchers::addLauncher(QString layoutName, uint senderId, int launcherGroup, QString launcherGroupId, QString launcher)
 {
     Types::LaunchersGroup group = static_cast<Types::LaunchersGroup>(launcherGroup);
     QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
 
-    for(const auto c : clients(lName, senderId, group, launcherGroupId)) {
-        if (auto *metaObject = c->metaObject()) {
-            int methodIndex = metaObject->indexOfMethod("removeSyncedLauncher(QVariant,QVariant)");
+    invoke(clients(lName, senderId, group, launcherGroupId), AddSyncedLauncher, launcherGroup, launcher);
+}
 
-            if (methodIndex == -1) {
-                qDebug() << "Launchers Syncer Ability: removeSyncedLauncher(QVariant,QVariant) was NOT found...";
-                continue;
-            }
+void SyncedLaunchers::removeLauncher(QString layoutName, uint senderId, int launcherGroup, QString launcherGroupId, QString launcher)
+{
+    Types::LaunchersGroup group = static_cast<Types::LaunchersGroup>(launcherGroup);
+    QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
 
-            QMetaMethod method = metaObject->method(methodIndex);
-            method.invoke(c, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher));
-        }
-    }
+    invoke(clients(lName, senderId, group, launcherGroupId), RemoveSyncedLauncher, launcherGroup, launcher);
 }
 
 void SyncedLaunchers::addLauncherToActivity(QString layoutName, uint senderId, int launcherGroup, QString launcherGroupId, QString launcher, QString activity)
@@ -155,19 +248,7 @@ void SyncedLaunchers::addLauncherToActivity(QString layoutName, uint senderId, i
     Types::LaunchersGroup group = static_cast<Types::LaunchersGroup>(launcherGroup);
     QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
 
-    for(const auto c : clients(lName, senderId, group, launcherGroupId)) {
-        if (auto *metaObject = c->metaObject()) {
-            int methodIndex = metaObject->indexOfMethod("addSyncedLauncherToActivity(QVariant,QVariant,QVariant)");
-
-            if (methodIndex == -1) {
-                qDebug() << "Launchers Syncer Ability: addSyncedLauncherToActivity(QVariant,QVariant,QVariant) was NOT found...";
-                continue;
-            }
-
-            QMetaMethod method = metaObject->method(methodIndex);
-            method.invoke(c, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher), Q_ARG(QVariant, activity));
-        }
-    }
+    invoke(clients(lName, senderId, group, launcherGroupId), AddSyncedLauncherToActivity, launcherGroup, launcher, activity);
 }
 
 void SyncedLaunchers::removeLauncherFromActivity(QString layoutName, uint senderId, int launcherGroup, QString launcherGroupId, QString launcher, QString activity)
@@ -175,19 +256,7 @@ void SyncedLaunchers::removeLauncherFromActivity(QString layoutName, uint sender
     Types::LaunchersGroup group = static_cast<Types::LaunchersGroup>(launcherGroup);
     QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
 
-    for(const auto c : clients(lName, senderId, group, launcherGroupId)) {
-        if (auto *metaObject = c->metaObject()) {
-            int methodIndex = metaObject->indexOfMethod("removeSyncedLauncherFromActivity(QVariant,QVariant,QVariant)");
-
-            if (methodIndex == -1) {
-                qDebug() << "Launchers Syncer Ability: removeSyncedLauncherFromActivity(QVariant,QVariant,QVariant) was NOT found...";
-                continue;
-            }
-
-            QMetaMethod method = metaObject->method(methodIndex);
-            method.invoke(c, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher), Q_ARG(QVariant, activity));
-        }
-    }
+    invoke(clients(lName, senderId, group, launcherGroupId), RemoveSyncedLauncherFromActivity, launcherGroup, launcher, activity);
 }
 
 void SyncedLaunchers::urlsDropped(QString layoutName, uint senderId, int launcherGroup, QString launcherGroupId, QStringList urls)
@@ -195,19 +264,7 @@ void SyncedLaunchers::urlsDropped(QString layoutName, uint senderId, int launche
     Types::LaunchersGroup group = static_cast<Types::LaunchersGroup>(launcherGroup);
     QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
 
-    for(const auto c : clients(lName, senderId, group, launcherGroupId)) {
-        if (auto *metaObject = c->metaObject()) {
-            int methodIndex = metaObject->indexOfMethod("dropSyncedUrls(QVariant,QVariant)");
-
-            if (methodIndex == -1) {
-                qDebug() << "Launchers Syncer Ability: dropSyncedUrls(QVariant,QVariant) was NOT found...";
-                continue;
-            }
-
-            QMetaMethod method = metaObject->method(methodIndex);
-            method.invoke(c, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, urls));
-        }
-    }
+    invoke(clients(lName, senderId, group, launcherGroupId), DropSyncedUrls, launcherGroup, urls);
 }
 
 void SyncedLaunchers::validateLaunchersOrder(QString layoutName, uint senderId, int launcherGroup, QString launcherGroupId, QStringList launchers)
@@ -215,23 +272,10 @@ void SyncedLaunchers::validateLaunchersOrder(QString layoutName, uint senderId,
     Types::LaunchersGroup group = static_cast<Types::LaunchersGroup>(launcherGroup);
     QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
 
-    for(const auto c : clients(lName, senderId, group, launcherGroupId)) {
-        auto tc = client(senderId);
+    QList<QQuickItem *> receivers = clients(lName, senderId, group, launcherGroupId);
+    receivers.removeAll(client(senderId));
 
-        if (c != tc) {
-            if (auto *metaObject = c->metaObject()) {
-                int methodIndex = metaObject->indexOfMethod("validateSyncedLaunchersOrder(QVariant,QVariant)");
-
-                if (methodIndex == -1) {
-                    qDebug() << "Launchers Syncer Ability: validateSyncedLaunchersOrder(QVariant,QVariant) was NOT found...";
-                    continue;
-                }
-
-                QMetaMethod method = metaObject->method(methodIndex);
-                method.invoke(c, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launchers));
-            }
-        }
-    }
+    invoke(receivers, ValidateSyncedLaunchersOrder, launcherGroup, launchers);
 }
 
 }
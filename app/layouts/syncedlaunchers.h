@@ -9,8 +9,13 @@
 // local
 #include <coretypes.h>
 
+// C++
+#include <array>
+
 // Qt
+#include <QHash>
 #include <QList>
+#include <QMetaMethod>
 #include <QObject>
 #include <QQuickItem>
 
@@ -53,17 +58,48 @@ public slots:
     Q_INVOKABLE void validateLaunchersOrder(QString layoutName, uint senderId, int launcherGroup, QString launcherGroupId, QStringList launchers);
 
 private:
+    //! synced methods that every client provides, resolved once when the client is registered
+    enum SyncedMethod
+    {
+        AddSyncedLauncher = 0,
+        RemoveSyncedLauncher,
+        AddSyncedLauncherToActivity,
+        RemoveSyncedLauncherFromActivity,
+        DropSyncedUrls,
+        ValidateSyncedLaunchersOrder,
+        SyncedMethodsCount
+    };
+
+    struct ClientEntry {
+        int id{-1};
+        QString layoutName;
+        QString groupId;
+        std::array<QMetaMethod, SyncedMethodsCount> methods;
+    };
+
     QList<QQuickItem *> clients(QString layoutName, QString groupId);
     QList<QQuickItem *> clients(QString layoutName, uint senderId, NSE::Types::LaunchersGroup launcherGroup, QString launcherGroupId);
     QQuickItem *client(const int &id);
 
+    void indexClient(QQuickItem *client);
+    void unindexClient(QQuickItem *client);
+
+    void invoke(const QList<QQuickItem *> &clients, SyncedMethod method,
+                const QVariant &arg1, const QVariant &arg2, const QVariant &arg3 = QVariant());
+
 private slots:
     void removeClientObject(QObject *obj);
+    void onClientPropertiesChanged();
 
 private:
     Layouts::Manager *m_manager{nullptr};
 
     QList<QQuickItem *> m_clients;
+
+    //! clients registry indexed by client id and by synced group id
+    QHash<QQuickItem *, ClientEntry> m_entries;
+    QHash<int, QQuickItem *> m_clientsById;
+    QHash<QString, QList<QQuickItem *>> m_clientsByGroupId;
 };
 
 }
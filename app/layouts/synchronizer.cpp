@@ -53,6 +53,11 @@ Synchronizer::Synchronizer(QObject *parent)
     m_updateBorderlessMaximized.setSingleShot(true);
     connect(&m_updateBorderlessMaximized, &QTimer::timeout, this, &Synchronizer::updateKWinDisabledBorders);
 
+    //! errors/warnings need the full layout file, they are counted after layouts are listed
+    m_layoutsIssuesTimer.setInterval(0);
+    m_layoutsIssuesTimer.setSingleShot(true);
+    connect(&m_layoutsIssuesTimer, &QTimer::timeout, this, &Synchronizer::countLayoutsIssues);
+
     //! KActivities tracking
     connect(m_manager->corona()->activitiesConsumer(), &KActivities::Consumer::activityRemoved,
             this, &Synchronizer::onActivityRemoved);
@@ -293,8 +298,11 @@ void Synchronizer::updateLayoutsTable()
             CentralLayout central(this, m_layouts[i].id);
             m_layouts[i].errors = central.errors().count();
             m_layouts[i].warnings = central.warnings().count();
+            m_catalogue.setIssues(m_layouts[i].id, m_layouts[i].errors, m_layouts[i].warnings);
         }
     }
+
+    m_catalogue.save();
 }
 
 CentralLayout *Synchronizer::centralLayout(QString layoutname) const
@@ -579,6 +587,7 @@ void Synchronizer::initLayouts()
     QStringList filter;
     filter.append(QString("*.layout.latte"));
     QStringList files = layoutDir.entryList(filter, QDir::Files | QDir::NoSymLinks);
+    QStringList layoutpaths;
 
     for (const auto &layout : files) {
         if (layout.contains(Layout::MULTIPLELAYOUTSHIDDENNAME)) {
@@ -587,11 +596,19 @@ void Synchronizer::initLayouts()
         }
 
         QString layoutpath = layoutDir.absolutePath() + "/" + layout;
-        onLayoutAdded(layoutpath);
+        layoutpaths << layoutpath;
+        m_layouts.insertBasedOnName(m_catalogue.layout(layoutpath));
     }
 
+    m_catalogue.retain(layoutpaths);
+    m_catalogue.save();
+
     emit layoutsChanged();
 
+    if (!m_catalogue.uncountedLayouts().isEmpty()) {
+        m_layoutsIssuesTimer.start();
+    }
+
     if (!m_isLoaded) {
         m_isLoaded = true;
         connect(m_manager->corona()->templatesManager(), &NSE::Templates::Manager::newLayoutAdded, this, &Synchronizer::onLayoutAdded);
@@ -601,12 +618,60 @@ void Synchronizer::initLayouts()
 
 void Synchronizer::onLayoutAdded(const QString &layout)
 {
-    CentralLayout centrallayout(this, layout);
-    m_layouts.insertBasedOnName(centrallayout.data());
+    Data::Layout layoutdata = m_catalogue.layout(layout);
+
+    if (layoutdata.isNull()) {
+        return;
+    }
+
+    m_layouts.insertBasedOnName(layoutdata);
+    m_catalogue.save();
 
     if (m_isLoaded) {
         emit layoutsChanged();
     }
+
+    m_layoutsIssuesTimer.start();
+}
+
+void Synchronizer::countLayoutsIssues()
+{
+    bool changed{false};
+
+    for (const auto &file : m_catalogue.uncountedLayouts()) {
+        if (!m_layouts.containsId(file)) {
+            continue;
+        }
+
+        Data::Layout &layoutdata = m_layouts[file];
+        CentralLayout *active = centralLayout(layoutdata.name);
+
+        int errors{0};
+        int warnings{0};
+
+        if (active) {
+            errors = active->errors().count();
+            warnings = active->warnings().count();
+        } else {
+            CentralLayout central(this, file);
+            errors = central.errors().count();
+            warnings = central.warnings().count();
+        }
+
+        m_catalogue.setIssues(file, errors, warnings);
+
+        if (layoutdata.errors != errors || layoutdata.warnings != warnings) {
+            layoutdata.errors = errors;
+            layoutdata.warnings = warnings;
+            changed = true;
+        }
+    }
+
+    m_catalogue.save();
+
+    if (changed) {
+        emit layoutsChanged();
+    }
 }
 
 void Synchronizer::reloadAssignedLayouts()
@@ -7,6 +7,7 @@
 #define LAYOUTSSYNCHRONIZER_H
 
 // local
+#include "catalogue.h"
 #include "../apptypes.h"
 #include "../data/layoutdata.h"
 #include "../data/layoutstable.h"
@@ -133,6 +134,8 @@ private slots:
     void onActivityRemoved(const QString &activityid);
     void onLayoutAdded(const QString &layoutpath);
 
+    void countLayoutsIssues();
+
     void unloadPreloadedLayouts();
     void reloadAssignedLayouts();
     void updateBorderlessMaximizedAfterTimer();
@@ -160,7 +163,9 @@ private:
     bool m_isSingleLayoutInDeprecatedRenaming{false};
 
     QTimer m_updateBorderlessMaximized;
+    QTimer m_layoutsIssuesTimer;
 
+    Catalogue m_catalogue;
     Data::LayoutsTable m_layouts;
     QList<CentralLayout *> m_centralLayouts;
     AssignedLayoutsHash m_assignedLayouts;
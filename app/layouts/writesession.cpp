@@ -0,0 +1,79 @@
+/* This file is a part of the Atmo desktop experience's SynDock project for SynOS.
+ * Copyright (C) 2026 Syndromatic Ltd. All rights reserved
+ * Designed by Kavish Krishnakumar in Manchester.
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "writesession.h"
+
+namespace NSE {
+namespace Layouts {
+
+WriteSession::WriteSession(const QString &filepath)
+    : m_filepath(filepath),
+      m_filePtr(KSharedConfig::openConfig(filepath))
+{
+}
+
+WriteSession::~WriteSession()
+{
+    commit();
+}
+
+QString WriteSession::file() const
+{
+    return m_filepath;
+}
+
+KConfigGroup WriteSession::containments() const
+{
+    return KConfigGroup(m_filePtr, "Containments");
+}
+
+void WriteSession::copyContainment(const KConfigGroup &source, const QString &containmentId)
+{
+    KConfigGroup destination = containments().group(containmentId);
+    source.copyTo(&destination);
+
+    //! containments stored in their layout file are not assigned to multiple layouts
+    destination.writeEntry("layoutId", "");
+    m_isDirty = true;
+}
+
+void WriteSession::removeContainment(const QString &containmentId)
+{
+    if (containmentId.isEmpty()) {
+        return;
+    }
+
+    KConfigGroup containmentGroup = containments().group(containmentId);
+
+    if (!containmentGroup.exists()) {
+        return;
+    }
+
+    containmentGroup.deleteGroup();
+    m_isDirty = true;
+}
+
+void WriteSession::removeContainments()
+{
+    containments().deleteGroup();
+    m_isDirty = true;
+}
+
+bool WriteSession::commit()
+{
+    if (!m_isDirty) {
+        return true;
+    }
+
+    m_isDirty = false;
+
+    //! KConfig saves through a temporary file that is renamed over the original one
+    return m_filePtr->sync();
+}
+
+}
+}
@@ -0,0 +1,48 @@
+/* This file is a part of the Atmo desktop experience's SynDock project for SynOS.
+ * Copyright (C) 2026 Syndromatic Ltd. All rights reserved
+ * Designed by Kavish Krishnakumar in Manchester.
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#ifndef LAYOUTSWRITESESSION_H
+#define LAYOUTSWRITESESSION_H
+
+// Qt
+#include <QString>
+
+// KDE
+#include <KConfigGroup>
+#include <KSharedConfig>
+
+namespace NSE {
+namespace Layouts {
+
+//! Collects the containment group copies and deletions of a layout file and writes
+//! them with one atomic save on commit(), instead of rewriting the file per change.
+//! Uncommitted changes are committed when the session is destroyed.
+class WriteSession
+{
+public:
+    WriteSession(const QString &filepath);
+    ~WriteSession();
+
+    QString file() const;
+    KConfigGroup containments() const;
+
+    void copyContainment(const KConfigGroup &source, const QString &containmentId);
+    void removeContainment(const QString &containmentId);
+    void removeContainments();
+
+    bool commit();
+
+private:
+    bool m_isDirty{false};
+    QString m_filepath;
+    KSharedConfigPtr m_filePtr;
+};
+
+}
+}
+
+#endif
@@ -16,6 +16,7 @@
 #include "apptypes.h"
 #include "syndockadaptor.h"
 #include "screenpool.h"
+#include "data/contextmenudata.h"
 #include "data/generictable.h"
 #include "data/layouticondata.h"
 #include "declarativeimports/interfaces.h"
@@ -56,6 +57,10 @@
 #include <QApplication>
 #include <QScreen>
 #include <QDBusConnection>
+#include <QDBusConnectionInterface>
+#include <QDBusPendingCallWatcher>
+#include <QDBusPendingReply>
+#include <QDateTime>
 #include <QDebug>
 // NOTE: QDesktopWidget removed in Qt 6 - using QScreen instead
 #include <QFile>
@@ -150,10 +155,30 @@ Corona::Corona(bool defaultLayoutOnStartup, QString layoutNameOnStartUp, QString
         m_viewsScreenSyncTimer.setInterval(m_universalSettings->screenTrackerInterval());
     });
 
+    //! context menu snapshot, versions start from the current time so that clients
+    //! never match a snapshot of a previous dock instance
+    m_contextMenuVersion = static_cast<qulonglong>(QDateTime::currentMSecsSinceEpoch());
+    connect(m_layoutsManager, &Layouts::Manager::centralLayoutsChanged, this, &Corona::invalidateContextMenuSnapshot);
+    connect(m_layoutsManager->synchronizer(), &Layouts::Synchronizer::centralLayoutsChanged, this, &Corona::invalidateContextMenuSnapshot);
+    connect(m_layoutsManager->synchronizer(), &Layouts::Synchronizer::layoutsChanged, this, &Corona::invalidateContextMenuSnapshot);
+    connect(m_layoutsManager->synchronizer(), &Layouts::Synchronizer::currentLayoutIsSwitching, this, &Corona::invalidateContextMenuSnapshot);
+    connect(m_templatesManager, &Templates::Manager::viewTemplatesChanged, this, &Corona::invalidateContextMenuSnapshot);
+    connect(m_universalSettings, &UniversalSettings::actionsChanged, this, &Corona::invalidateContextMenuSnapshot);
+    connect(m_universalSettings, &UniversalSettings::layoutsMemoryUsageChanged, this, &Corona::invalidateContextMenuSnapshot);
+    connect(m_activitiesConsumer, &KActivities::Consumer::currentActivityChanged, this, &Corona::invalidateContextMenuSnapshot);
+
     //! Dbus adaptor initialization
     new SynDockAdaptor(this);
     QDBusConnection dbus = QDBusConnection::sessionBus();
     dbus.registerObject(QStringLiteral("/SynDock"), this);
+
+    m_dbusServicePidsWatcher = new QDBusServiceWatcher(this);
+    m_dbusServicePidsWatcher->setConnection(dbus);
+    m_dbusServicePidsWatcher->setWatchMode(QDBusServiceWatcher::WatchForUnregistration);
+    connect(m_dbusServicePidsWatcher, &QDBusServiceWatcher::serviceUnregistered, this, [this](const QString &service) {
+        m_dbusServicePids.remove(service);
+        m_dbusServicePidsWatcher->removeWatchedService(service);
+    });
 }
 
 Corona::~Corona()
@@ -1096,17 +1121,54 @@ void Corona::windowColorScheme(QString windowIdAndScheme)
     QString windowIdStr = windowIdAndScheme.mid(0, firstSlash);
     QString schemeStr = windowIdAndScheme.mid(firstSlash + 1);
 
-    if (KWindowSystem::isPlatformWayland()) {
-        QTimer::singleShot(200, [this, schemeStr]() {
-            //! [Wayland Case] - give the time to be informed correctly for the active window id
-            //! otherwise the active window id may not be the same with the one triggered
-            //! the colour scheme dbus signal
-            QString windowIdStr = m_wm->activeWindow().toString();
-            m_wm->schemesTracker()->setColorSchemeForWindow(windowIdStr.toUInt(), schemeStr);
-        });
-    } else {
+    if (!KWindowSystem::isPlatformWayland()) {
         m_wm->schemesTracker()->setColorSchemeForWindow(windowIdStr.toUInt(), schemeStr);
+        return;
+    }
+
+    //! [Wayland Case] - the window id sent is not a wayland one, so the window is identified
+    //! through the process that sent the dbus message
+    const QString service = calledFromDBus() ? message().service() : QString();
+
+    if (service.isEmpty() || m_dbusServicePids.contains(service)) {
+        setColorSchemeForProcess(m_dbusServicePids.value(service, 0), schemeStr);
+        return;
     }
+
+    QDBusPendingCall pidCall = connection().interface()->asyncCall(QStringLiteral("GetConnectionUnixProcessID"), service);
+    auto watcher = new QDBusPendingCallWatcher(pidCall, this);
+
+    connect(watcher, &QDBusPendingCallWatcher::finished, this, [this, service, schemeStr](QDBusPendingCallWatcher *call) {
+        QDBusPendingReply<quint32> reply = *call;
+        call->deleteLater();
+
+        quint32 pid = reply.isValid() ? reply.value() : 0;
+
+        if (pid > 0 && !m_dbusServicePids.contains(service)) {
+            m_dbusServicePids[service] = pid;
+            m_dbusServicePidsWatcher->addWatchedService(service);
+        }
+
+        setColorSchemeForProcess(pid, schemeStr);
+    });
+}
+
+void Corona::setColorSchemeForProcess(quint32 pid, const QString &scheme)
+{
+    WindowSystem::WindowId wid = m_wm->winIdFor(pid);
+
+    if (!wid.isNull()) {
+        m_wm->schemesTracker()->setColorSchemeForWindow(wid.toString().toUInt(), scheme);
+        return;
+    }
+
+    QTimer::singleShot(200, this, [this, scheme]() {
+        //! the process could not be identified, e.g. sandboxed clients, so give the time
+        //! to be informed correctly for the active window id otherwise the active window id
+        //! may not be the same with the one triggered the colour scheme dbus signal
+        QString windowIdStr = m_wm->activeWindow().toString();
+        m_wm->schemesTracker()->setColorSchemeForWindow(windowIdStr.toUInt(), scheme);
+    });
 }
 
 //! update badge for specific view item
@@ -1247,6 +1309,79 @@ QStringList Corona::viewTemplatesData()
     return data;
 }
 
+void Corona::invalidateContextMenuSnapshot()
+{
+    m_contextMenuSnapshotDirty = true;
+    ++m_contextMenuVersion;
+}
+
+void Corona::updateContextMenuSnapshot()
+{
+    if (!m_contextMenuSnapshotDirty) {
+        return;
+    }
+
+    QStringList layoutNames;
+    QStringList layoutIcons;
+    QStringList backgroundIconLayouts;
+
+    for(const auto &layoutName : m_layoutsManager->synchronizer()->menuLayouts()) {
+        if (m_layoutsManager->synchronizer()->centralLayout(layoutName)
+                || m_layoutsManager->memoryUsage() == NSE::MemoryUsage::SingleLayout) {
+            Data::LayoutIcon layouticon = m_layoutsManager->iconForLayout(layoutName);
+            layoutNames << layoutName;
+            layoutIcons << layouticon.name;
+
+            if (layouticon.isBackgroundFile) {
+                backgroundIconLayouts << layoutName;
+            }
+        }
+    }
+
+    QStringList templateNames;
+    QStringList templateIds;
+    NSE::Data::GenericTable<Data::Generic> viewtemplates = m_templatesManager->viewTemplates();
+
+    for(int i=0; i<viewtemplates.rowCount(); ++i) {
+        templateNames << viewtemplates[i].name;
+        templateIds << viewtemplates[i].id;
+    }
+
+    m_contextMenuSnapshot.clear();
+    m_contextMenuSnapshot[Data::ContextMenu::SNAPSHOTMEMORYUSAGE] = (int)m_layoutsManager->memoryUsage();
+    m_contextMenuSnapshot[Data::ContextMenu::SNAPSHOTACTIVELAYOUTS] = m_layoutsManager->centralLayoutsNames();
+    m_contextMenuSnapshot[Data::ContextMenu::SNAPSHOTCURRENTLAYOUTS] = m_layoutsManager->synchronizer()->currentLayoutsNames();
+    m_contextMenuSnapshot[Data::ContextMenu::SNAPSHOTACTIONSALWAYSSHOWN] = m_universalSettings->contextMenuActionsAlwaysShown();
+    m_contextMenuSnapshot[Data::ContextMenu::SNAPSHOTMENULAYOUTS] = layoutNames;
+    m_contextMenuSnapshot[Data::ContextMenu::SNAPSHOTMENULAYOUTICONS] = layoutIcons;
+    m_contextMenuSnapshot[Data::ContextMenu::SNAPSHOTBACKGROUNDICONLAYOUTS] = backgroundIconLayouts;
+    m_contextMenuSnapshot[Data::ContextMenu::SNAPSHOTTEMPLATENAMES] = templateNames;
+    m_contextMenuSnapshot[Data::ContextMenu::SNAPSHOTTEMPLATEIDS] = templateIds;
+
+    m_contextMenuSnapshotDirty = false;
+}
+
+QVariantMap Corona::contextMenuSnapshot(const uint &containmentId, const qulonglong &knownVersion)
+{
+    QVariantMap snapshot;
+
+    if (knownVersion != m_contextMenuVersion || m_contextMenuSnapshotDirty) {
+        updateContextMenuSnapshot();
+        snapshot = m_contextMenuSnapshot;
+    }
+
+    snapshot[Data::ContextMenu::SNAPSHOTVERSION] = m_contextMenuVersion;
+
+    auto view = m_layoutsManager->synchronizer()->viewForContainment(containmentId);
+
+    snapshot[Data::ContextMenu::SNAPSHOTVIEWLAYOUT] = view ? view->layout()->name() : QString();
+    snapshot[Data::ContextMenu::SNAPSHOTVIEWTYPE] = (int)(view ? view->type() : Types::DockView);
+    snapshot[Data::ContextMenu::SNAPSHOTVIEWISCLONED] = (view && view->isCloned());
+    snapshot[Data::ContextMenu::SNAPSHOTVIEWCLONESCOUNT] = (view && view->isOriginal()) ? qobject_cast<NSE::OriginalView *>(view)->clonesCount() : 0;
+
+    return snapshot;
+}
+
 void Corona::addView(const uint &containmentId, const QString &templateId)
 {
     if (containmentId <= 0) {
@@ -1349,6 +1484,7 @@ inline void Corona::qmlRegisterTypes() const
     qmlRegisterType<NSE::ContextMenuLayerQuickItem>("org.kde.syndock.private.app", 0, 1, "ContextMenuLayer");
     qmlRegisterAnonymousType<QScreen>("syndock", 1);
     qmlRegisterAnonymousType<NSE::View>("syndock", 1);
+    qmlRegisterAnonymousType<NSE::ViewPart::SurfaceGeometry>("syndock", 1);
     qmlRegisterAnonymousType<NSE::ViewPart::WindowsTracker>("syndock", 1);
     qmlRegisterAnonymousType<NSE::ViewPart::TrackerPart::CurrentScreenTracker>("syndock", 1);
     qmlRegisterAnonymousType<NSE::ViewPart::TrackerPart::AllScreensTracker>("syndock", 1);
@@ -18,6 +18,9 @@
 #include "view/panelshadows_p.h"
 
 // Qt
+#include <QDBusContext>
+#include <QDBusServiceWatcher>
+#include <QHash>
 #include <QObject>
 #include <QTimer>
 
@@ -106,7 +109,7 @@ class AbstractWindowInterface;
  * 
  * @note D-Bus interface updated from org.kde.SynDock to org.syndromatic.SynDock
  */
-class Corona : public Plasma::Corona
+class Corona : public Plasma::Corona, protected QDBusContext
 {
     Q_OBJECT
     Q_CLASSINFO("D-Bus Interface", "org.syndromatic.SynDock")
@@ -190,6 +193,9 @@ public:
 
     QStringList contextMenuData(const uint &containmentId);
     QStringList viewTemplatesData();
+    //! view specific entries are always present, shared entries only when
+    //! knownVersion does not match the current snapshot version
+    QVariantMap contextMenuSnapshot(const uint &containmentId, const qulonglong &knownVersion);
 
 public slots:
     void aboutApplication();
@@ -235,10 +241,14 @@ private slots:
     void onScreenGeometryChanged(const QRect &geometry);
     void syncDockViewsToScreens();
 
+    void invalidateContextMenuSnapshot();
+
 private:
     void cleanConfig();
+    void updateContextMenuSnapshot();
     void qmlRegisterTypes() const;
     void setupWaylandIntegration();
+    void setColorSchemeForProcess(quint32 pid, const QString &scheme);
 
     bool appletExists(uint containmentId, uint appletId) const;
     bool containmentExists(uint id) const;
@@ -266,6 +276,16 @@ private:
 
     QList<KDeclarative::QmlObjectSharedEngine *> m_alternativesObjects;
 
+    //! dbus unique names are never reused, so their process ids can be cached
+    //! until their clients disconnect
+    QHash<QString, quint32> m_dbusServicePids;
+    QDBusServiceWatcher *m_dbusServicePidsWatcher{nullptr};
+
+    //! layouts, actions and templates shown from context menus, rebuilt lazily after invalidation
+    bool m_contextMenuSnapshotDirty{true};
+    qulonglong m_contextMenuVersion{0};
+    QVariantMap m_contextMenuSnapshot;
+
     QTimer m_viewsScreenSyncTimer;
 
     KActivities::Consumer *m_activitiesConsumer;
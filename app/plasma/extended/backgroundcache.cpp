@@ -7,6 +7,7 @@
 
 // local
 #include "../../tools/commontools.h"
+#include "../../tools/filewatchrouter.h"
 
 // Qt
 #include <QDebug>
@@ -22,7 +23,6 @@
 
 // KDE
 #include <KConfigGroup>
-#include <KDirWatch>
 
 #define MAXHASHSIZE 300
 
@@ -45,10 +45,11 @@ BackgroundCache::BackgroundCache(QObject *parent)
 
     qDebug() << "Default Wallpaper path ::: " << m_defaultWallpaperPath;
 
-    KDirWatch::self()->addFile(configFile);
-
-    connect(KDirWatch::self(), &KDirWatch::dirty, this, &BackgroundCache::settingsFileChanged);
-    connect(KDirWatch::self(), &KDirWatch::created, this, &BackgroundCache::settingsFileChanged);
+    FileWatchRouter::self()->watchFile(this, configFile, [&](const QString &path, FileWatchRouter::Changes changes) {
+        if (changes & (FileWatchRouter::Dirty | FileWatchRouter::Created)) {
+            settingsFileChanged(path);
+        }
+    });
 
     if (!m_pool) {
         m_pool = new ScreenPool(this);
@@ -0,0 +1,146 @@
+/* This file is a part of the Atmo desktop experience's SynDock project for SynOS.
+ * Copyright (C) 2026 Syndromatic Ltd. All rights reserved
+ * Designed by Kavish Krishnakumar in Manchester.
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "cornermask.h"
+
+// Qt
+#include <QHash>
+#include <QPair>
+#include <QVarLengthArray>
+#include <QtMath>
+
+namespace NSE {
+namespace PlasmaExtended {
+
+CornerMask CornerMask::forRadius(int radius, qreal devicePixelRatio)
+{
+    CornerMask mask;
+
+    if (radius <= 0) {
+        return mask;
+    }
+
+    //! dpr is rounded in order to avoid floating point keys for the same scale factor
+    static QHash<QPair<int, int>, QList<int>> s_insets;
+    const QPair<int, int> key(radius, qRound(qMax(devicePixelRatio, 1.0) * 100));
+
+    auto cached = s_insets.constFind(key);
+
+    if (cached == s_insets.constEnd()) {
+        cached = s_insets.insert(key, computeInsets(radius, devicePixelRatio));
+    }
+
+    mask.m_radius = radius;
+    mask.m_insets = *cached;
+    return mask;
+}
+
+QList<int> CornerMask::computeInsets(int radius, qreal devicePixelRatio)
+{
+    //! the circle is sampled at device pixels, a logical row keeps the smallest inset
+    //! of its device rows so that no visible pixel is ever cut away
+    const qreal dpr = qMax(devicePixelRatio, 1.0);
+    const qreal deviceRadius = radius * dpr;
+    const int deviceRows = qCeil(deviceRadius);
+
+    QList<int> insets(radius, 0);
+
+    for (int y = 0; y < radius; ++y) {
+        qreal minimumInset = deviceRadius;
+        const int firstRow = qFloor(y * dpr);
+        const int lastRow = qMin(qCeil((y + 1) * dpr), deviceRows) - 1;
+
+        for (int row = firstRow; row <= lastRow; ++row) {
+            //! distance of the pixel row center from the circle center
+            const qreal dy = deviceRadius - (row + 0.5);
+            const qreal dx = qSqrt(qMax<qreal>(0.0, (deviceRadius * deviceRadius) - (dy * dy)));
+            minimumInset = qMin(minimumInset, deviceRadius - dx);
+        }
+
+        insets[y] = qMax(0, qFloor(minimumInset / dpr));
+    }
+
+    return insets;
+}
+
+bool CornerMask::isNull() const
+{
+    return m_radius <= 0 || m_insets.isEmpty();
+}
+
+int CornerMask::radius() const
+{
+    return m_radius;
+}
+
+QRegion CornerMask::roundedRegion(const QRect &rect, bool topLeft, bool topRight, bool bottomLeft, bool bottomRight) const
+{
+    if (rect.isEmpty() || isNull() || !(topLeft || topRight || bottomLeft || bottomRight)) {
+        return QRegion(rect);
+    }
+
+    const int height = rect.height();
+    const int width = rect.width();
+
+    //! one rectangle per row that differs from the previous one, rows with identical
+    //! spans are merged in order to respect QRegion banding rules
+    QVarLengthArray<QRect, 64> rects;
+
+    auto addRow = [&](int y, int rowsCount, int left, int right) {
+        if (left + right >= width) {
+            return;
+        }
+
+        const int x = rect.x() + left;
+        const int w = width - left - right;
+        const int top = rect.y() + y;
+
+        if (!rects.isEmpty()) {
+            QRect &last = rects.last();
+
+            if (last.x() == x && last.width() == w && (last.y() + last.height()) == top) {
+                last.setHeight(last.height() + rowsCount);
+                return;
+            }
+        }
+
+        rects.append(QRect(x, top, w, rowsCount));
+    };
+
+    auto insetAt = [&](int row) {
+        return (row >= 0 && row < m_insets.count()) ? m_insets[row] : 0;
+    };
+
+    const int topRows = qMin(m_radius, height);
+    const int bottomStart = qMax(height - m_radius, topRows);
+
+    for (int y = 0; y < topRows; ++y) {
+        //! short rects can be touched from both top and bottom corners
+        const int bottomRow = height - 1 - y;
+        const int left = qMax(topLeft ? insetAt(y) : 0, bottomLeft ? insetAt(bottomRow) : 0);
+        const int right = qMax(topRight ? insetAt(y) : 0, bottomRight ? insetAt(bottomRow) : 0);
+        addRow(y, 1, left, right);
+    }
+
+    if (bottomStart > topRows) {
+        addRow(topRows, bottomStart - topRows, 0, 0);
+    }
+
+    for (int y = bottomStart; y < height; ++y) {
+        const int bottomRow = height - 1 - y;
+        const int left = bottomLeft ? insetAt(bottomRow) : 0;
+        const int right = bottomRight ? insetAt(bottomRow) : 0;
+        addRow(y, 1, left, right);
+    }
+
+    QRegion region;
+    region.setRects(rects.constData(), rects.count());
+    return region;
+}
+
+}
+}
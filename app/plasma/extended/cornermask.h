@@ -0,0 +1,48 @@
+/* This file is a part of the Atmo desktop experience's SynDock project for SynOS.
+ * Copyright (C) 2026 Syndromatic Ltd. All rights reserved
+ * Designed by Kavish Krishnakumar in Manchester.
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#ifndef PLASMAEXTENDEDCORNERMASK_H
+#define PLASMAEXTENDEDCORNERMASK_H
+
+// Qt
+#include <QList>
+#include <QRect>
+#include <QRegion>
+
+namespace NSE {
+namespace PlasmaExtended {
+
+//! Rounded corners mask described analytically as a span table. For every row of a
+//! corner it holds the width that must be cut away from the outer edge. Tables are
+//! computed once per radius and device pixel ratio and are shared by all views.
+class CornerMask
+{
+public:
+    CornerMask() = default;
+
+    static CornerMask forRadius(int radius, qreal devicePixelRatio = 1.0);
+
+    bool isNull() const;
+    int radius() const;
+
+    //! returns rect with the requested corners rounded, it is built from at most
+    //! 2*radius+1 rectangles and does not need any painting
+    QRegion roundedRegion(const QRect &rect, bool topLeft, bool topRight, bool bottomLeft, bool bottomRight) const;
+
+private:
+    static QList<int> computeInsets(int radius, qreal devicePixelRatio);
+
+private:
+    int m_radius{0};
+    //! implicitly shared with the process wide cache
+    QList<int> m_insets;
+};
+
+}
+}
+
+#endif
@@ -8,6 +8,7 @@
 // local
 #include "../../primaryoutputwatcher.h"
 #include "../../tools/commontools.h"
+#include "../../tools/filewatchrouter.h"
 
 // Qt
 #include <QDebug>
@@ -17,7 +18,6 @@
 
 // KDE
 #include <KConfigGroup>
-#include <KDirWatch>
 #include <KSharedConfig>
 
 #define PLASMARC "plasmashellrc"
@@ -36,16 +36,8 @@ ScreenPool::ScreenPool(QObject *parent)
 
     QString plasmaSettingsFile = NSE::configPath() + "/" + PLASMARC;
 
-    KDirWatch::self()->addFile(plasmaSettingsFile);
-
-    connect(KDirWatch::self(), &KDirWatch::dirty, this, [ &, plasmaSettingsFile](const QString & path) {
-        if (path == plasmaSettingsFile) {
-            load();
-        }
-    });
-
-    connect(KDirWatch::self(), &KDirWatch::created, this, [ &, plasmaSettingsFile](const QString & path) {
-        if (path == plasmaSettingsFile) {
+    FileWatchRouter::self()->watchFile(this, plasmaSettingsFile, [&](const QString &, FileWatchRouter::Changes changes) {
+        if (changes & (FileWatchRouter::Dirty | FileWatchRouter::Created)) {
             load();
         }
     });
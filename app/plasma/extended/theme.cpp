@@ -12,14 +12,13 @@
 #include "../../view/panelshadows_p.h"
 #include "../../wm/schemecolors.h"
 #include "../../tools/commontools.h"
+#include "../../tools/filewatchrouter.h"
 
 // Qt
 #include <QDebug>
 #include <QDir>
-#include <QPainter>
 
 // KDE
-#include <KDirWatch>
 #include <KConfigGroup>
 #include <KSharedConfig>
 
@@ -370,9 +369,10 @@ void Theme::loadThemePaths()
     qDebug() << "theme path ::: " << m_themePath;
     qDebug() << "theme widgets path ::: " << m_themeWidgetsPath;
 
-    //! clear kde connections
-    for (auto &c : m_kdeConnections) {
-        disconnect(c);
+    //! clear kde settings tracking
+    if (m_kdeSettingsWatchId > 0) {
+        FileWatchRouter::self()->unwatch(m_kdeSettingsWatchId);
+        m_kdeSettingsWatchId = 0;
     }
 
     //! assign colour schemes
@@ -385,16 +385,8 @@ void Theme::loadThemePaths()
         //! we track when kde colour scheme is changing
         QString kdeSettingsFile = NSE::configPath() + "/kdeglobals";
 
-        KDirWatch::self()->addFile(kdeSettingsFile);
-
-        m_kdeConnections[0] = connect(KDirWatch::self(), &KDirWatch::dirty, this, [ &, kdeSettingsFile](const QString & path) {
-            if (path == kdeSettingsFile) {
-                this->setOriginalSchemeFile(WindowSystem::SchemeColors::possibleSchemeFile("kdeglobals"));
-            }
-        });
-
-        m_kdeConnections[1] = connect(KDirWatch::self(), &KDirWatch::created, this, [ &, kdeSettingsFile](const QString & path) {
-            if (path == kdeSettingsFile) {
+        m_kdeSettingsWatchId = FileWatchRouter::self()->watchFile(this, kdeSettingsFile, [&](const QString &, FileWatchRouter::Changes changes) {
+            if (changes & (FileWatchRouter::Dirty | FileWatchRouter::Created)) {
                 this->setOriginalSchemeFile(WindowSystem::SchemeColors::possibleSchemeFile("kdeglobals"));
             }
         });
@@ -421,76 +413,6 @@ void Theme::loadThemeLightness()
     }
 }
 
-const CornerRegions &Theme::cornersMask(const int &radius)
-{
-    if (m_cornerRegions.contains(radius)) {
-        return m_cornerRegions[radius];
-    }
-
-    qDebug() << radius;
-    CornerRegions corners;
-
-    int axis = (2 * radius) + 2;
-    QImage cornerimage(axis, axis, QImage::Format_ARGB32);
-    QPainter painter(&cornerimage);
-    //!does not provide valid masks ?
-    painter.setRenderHints(QPainter::Antialiasing);
-
-    QPen pen(Qt::black);
-    pen.setStyle(Qt::SolidLine);
-    pen.setWidth(1);
-    painter.setPen(pen);
-
-    QRect rectArea(0,0,axis,axis);
-    painter.fillRect(rectArea, Qt::white);
-    painter.drawRoundedRect(rectArea, axis, axis);
-
-    QRegion topleft;
-    for(int y=0; y<radius; ++y) {
-        QRgb *line = (QRgb *)cornerimage.scanLine(y);
-
-        QString bits;
-        int width{0};
-        for(int x=0; x<radius; ++x) {
-            QRgb point = line[x];
-
-            if (QColor(point) != Qt::white) {
-                bits = bits + "1 ";
-                width = qMax(0, x);
-                break;
-            } else {
-                bits = bits + "0 ";
-            }
-        }
-
-        if (width>0) {
-            topleft += QRect(0, y, width, 1);
-        }
-
-        qDebug()<< "  " << bits;
-    }
-    corners.topLeft = topleft;
-
-    QTransform transform;
-    transform.rotate(90);
-    corners.topRight = transform.map(corners.topLeft);
-    corners.topRight.translate(corners.topLeft.boundingRect().width(), 0);
-
-    corners.bottomRight = transform.map(corners.topRight);
-    corners.bottomRight.translate(corners.topLeft.boundingRect().width(), 0);
-
-    corners.bottomLeft = transform.map(corners.bottomRight);
-    corners.bottomLeft.translate(corners.topLeft.boundingRect().width(), 0);
-
-    //qDebug() << " reg top;: " << corners.topLeft;
-    //qDebug() << " reg topr: " << corners.topRight;
-    //qDebug() << " reg bottomr: " << corners.bottomRight;
-    //qDebug() << " reg bottoml: " << corners.bottomLeft;
-
-    m_cornerRegions[radius] = corners;
-    return m_cornerRegions[radius];
-}
-
 void Theme::updateMarginsAreaValues()
 {
     m_marginsAreaTop = 0;
@@ -6,9 +6,6 @@
 #ifndef PLASMATHEMEEXTENDED_H
 #define PLASMATHEMEEXTENDED_H
 
-// C++
-#include <array>
-
 // Qt
 #include <QObject>
 #include <QHash>
@@ -38,13 +35,6 @@ class PanelBackground;
 namespace NSE {
 namespace PlasmaExtended {
 
-struct CornerRegions {
-    QRegion topLeft;
-    QRegion topRight;
-    QRegion bottomLeft;
-    QRegion bottomRight;
-};
-
 class Theme: public QObject
 {
     Q_OBJECT
@@ -93,8 +83,6 @@ public:
     WindowSystem::SchemeColors *lightTheme() const;
     WindowSystem::SchemeColors *darkTheme() const;
 
-    const CornerRegions &cornersMask(const int &radius);
-
     void load();
 
 signals:
@@ -143,9 +131,7 @@ private:
     QString m_originalSchemePath;
     QString m_reversedSchemePath;
 
-    QHash<int, CornerRegions> m_cornerRegions;
-
-    std::array<QMetaObject::Connection, 2> m_kdeConnections;
+    int m_kdeSettingsWatchId{0};
 
     QTemporaryDir m_extendedThemeDir;
     KConfigGroup m_themeGroup;
@@ -6,10 +6,17 @@
 #include "generictools.h"
 
 // Qt
+#include <QAbstractItemView>
 #include <QApplication>
+#include <QCache>
 #include <QDebug>
+#include <QFileInfo>
+#include <QHash>
+#include <QImageReader>
+#include <QPointer>
 #include <QStyle>
 #include <QTextDocument>
+#include <QThreadPool>
 
 namespace NSE {
 
@@ -18,6 +25,114 @@ const int INDICATORCHANGESLENGTH = 6;
 const int INDICATORCHANGESMARGIN = 5;
 const int MARGIN = 2;
 
+namespace {
+//! layout background thumbnails shared by all tables, comboboxes and menus of the process,
+//! cost is measured in KB
+QCache<QString, QPixmap> &layoutThumbnails()
+{
+    static QCache<QString, QPixmap> thumbnails(4 * 1024);
+    return thumbnails;
+}
+
+//! widgets that painted a placeholder and must be repainted when the thumbnail is decoded
+QHash<QString, QList<QPointer<QWidget>>> &pendingLayoutThumbnails()
+{
+    static QHash<QString, QList<QPointer<QWidget>>> pending;
+    return pending;
+}
+
+QWidget *requestingWidget(const QStyleOption &option)
+{
+    if (auto viewOption = qstyleoption_cast<const QStyleOptionViewItem *>(&option)) {
+        if (viewOption->widget) {
+            return const_cast<QWidget *>(viewOption->widget);
+        }
+    }
+
+    return qobject_cast<QWidget *>(option.styleObject);
+}
+
+//! decodes only the pixels needed, jpeg readers scale while decoding
+QImage decodeLayoutThumbnail(const QString &path, const QSize &size)
+{
+    QImageReader reader(path);
+    reader.setAutoTransform(true);
+
+    const QSize original = reader.size();
+
+    if (original.isValid()) {
+        reader.setScaledSize(original.scaled(size, Qt::KeepAspectRatioByExpanding));
+    }
+
+    QImage image = reader.read();
+
+    if (image.isNull()) {
+        return image;
+    }
+
+    if (image.width() < size.width() || image.height() < size.height()) {
+        image = image.scaled(size, Qt::KeepAspectRatioByExpanding, Qt::SmoothTransformation);
+    }
+
+    return image.copy(QRect((image.width() - size.width()) / 2, (image.height() - size.height()) / 2, size.width(), size.height()));
+}
+
+//! returns a null pixmap while the thumbnail is decoded in the background, the requester
+//! is repainted when it becomes available
+QPixmap layoutThumbnail(const QString &path, const QSize &size, qreal dpr, QWidget *requester)
+{
+    const QSize pixelSize = size * dpr;
+    const QString key = QStringLiteral("%1|%2|%3x%4|%5").arg(path,
+                                                             QString::number(QFileInfo(path).lastModified().toMSecsSinceEpoch()),
+                                                             QString::number(pixelSize.width()),
+                                                             QString::number(pixelSize.height()),
+                                                             QString::number(dpr));
+
+    if (QPixmap *thumbnail = layoutThumbnails().object(key)) {
+        return *thumbnail;
+    }
+
+    auto &pending = pendingLayoutThumbnails();
+    const bool scheduled = pending.contains(key);
+    auto &requesters = pending[key];
+
+    if (requester && !requesters.contains(requester)) {
+        requesters << requester;
+    }
+
+    if (scheduled) {
+        return QPixmap();
+    }
+
+    QThreadPool::globalInstance()->start([key, path, pixelSize, dpr]() {
+        const QImage image = decodeLayoutThumbnail(path, pixelSize);
+
+        QMetaObject::invokeMethod(qApp, [key, image, dpr]() {
+            auto thumbnail = new QPixmap(QPixmap::fromImage(image));
+            thumbnail->setDevicePixelRatio(dpr);
+            //! failed decodings are cached too, so they are not retried on every paint
+            layoutThumbnails().insert(key, thumbnail, qMax(1, static_cast<int>(image.sizeInBytes() / 1024)));
+
+            const auto requesters = pendingLayoutThumbnails().take(key);
+
+            for (const auto &widget : requesters) {
+                if (!widget) {
+                    continue;
+                }
+
+                if (auto view = qobject_cast<QAbstractItemView *>(widget)) {
+                    view->viewport()->update();
+                } else {
+                    widget->update();
+                }
+            }
+        }, Qt::QueuedConnection);
+    });
+
+    return QPixmap();
+}
+}
+
 bool isEnabled(const QStyleOption &option)
 {
     if (option.state & QStyle::State_Enabled) {
@@ -263,16 +378,23 @@ void drawLayoutIcon(QPainter *painter, const QStyleOption &option, const bool &i
         int backImageMargin = 1; //most icon themes provide 1-2px. padding around icons //OLD CALCS: ICONMARGIN; //qMin(target.height()/4, ICONMARGIN+1);
         QRect backTarget(target.x() + backImageMargin, target.y() + backImageMargin, target.width() - 2*backImageMargin, target.height() - 2*backImageMargin);
 
-        QPixmap backImage(iconName);
-        backImage = backImage.copy(backTarget);
+        const qreal dpr = painter->device() ? painter->device()->devicePixelRatioF() : qApp->devicePixelRatio();
+        const QPixmap backImage = layoutThumbnail(iconName, backTarget.size(), dpr, requestingWidget(option));
 
         QPalette::ColorRole textColorRole = selected ? QPalette::HighlightedText : QPalette::Text;
 
-        QBrush imageBrush(backImage);
         QPen pen; pen.setWidth(1);
         pen.setColor(option.palette.color(NSE::colorGroup(option), textColorRole));
 
-        painter->setBrush(imageBrush);
+        if (backImage.isNull()) {
+            //! placeholder until the thumbnail is decoded
+            painter->setBrush(option.palette.color(NSE::colorGroup(option), QPalette::Mid));
+        } else {
+            QBrush imageBrush(backImage);
+            imageBrush.setTransform(QTransform::fromTranslate(backTarget.x(), backTarget.y()).scale(1 / dpr, 1 / dpr));
+            painter->setBrush(imageBrush);
+        }
+
         painter->setPen(pen);
 
         painter->drawEllipse(backTarget);
@@ -855,11 +855,12 @@ bool Layouts::importLayoutsFromV1ConfigFile(QString file)
     if (archive.isOpen()) {
         QDir tempDir{uniqueTempDirectory()};
 
+        //! only the applets file is needed to import the old layouts
         const auto archiveRootDir = archive.directory();
+        const auto appletsEntry = archiveRootDir ? archiveRootDir->file(QStringLiteral("lattedock-appletsrc")) : nullptr;
 
-        for (const auto &name : archiveRootDir->entries()) {
-            auto fileEntry = archiveRootDir->file(name);
-            fileEntry->copyTo(tempDir.absolutePath());
+        if (appletsEntry) {
+            appletsEntry->copyTo(tempDir.absolutePath());
         }
 
         QString name = NSE::Layouts::Importer::nameOfConfigFile(file);
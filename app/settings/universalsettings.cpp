@@ -14,6 +14,7 @@
 #include "../layouts/importer.h"
 #include "../layouts/manager.h"
 #include "../tools/commontools.h"
+#include "../tools/filewatchrouter.h"
 
 // Qt
 #include <QDebug>
@@ -22,7 +23,6 @@
 
 // KDE
 #include <KActivities/Consumer>
-#include <KDirWatch>
 #include <KWindowSystem>
 
 #define KWINMETAFORWARDTOLATTESTRING "org.syndromatic.syndock,/SynDock,org.syndromatic.SynDock,activateLauncherMenu"
@@ -97,24 +97,24 @@ void UniversalSettings::load()
     //! Track KWin Colors Script Presence
     updateColorsScriptIsPresent();
 
+    auto trackedFileHandler = [&](const QString &path, FileWatchRouter::Changes) {
+        trackedFileChanged(path);
+    };
+
     QStringList colorsScriptPaths = Layouts::Importer::standardPathsFor(KWINCOLORSSCRIPT);
     for(auto path: colorsScriptPaths) {
-        KDirWatch::self()->addDir(path);
+        FileWatchRouter::self()->watchDir(this, path, trackedFileHandler);
     }
 
     //! Track KWin rc options
     const QString kwinrcFilePath = NSE::configPath() + "/" + KWINRC;
-    KDirWatch::self()->addFile(kwinrcFilePath);
+    FileWatchRouter::self()->watchFile(this, kwinrcFilePath, trackedFileHandler);
     recoverKWinOptions();
 
     m_kwinrcTrackerTimer.setSingleShot(true);
     m_kwinrcTrackerTimer.setInterval(KWINRCTRACKERINTERVAL);
     connect(&m_kwinrcTrackerTimer, &QTimer::timeout, this, &UniversalSettings::recoverKWinOptions);
 
-    connect(KDirWatch::self(), &KDirWatch::created, this, &UniversalSettings::trackedFileChanged);
-    connect(KDirWatch::self(), &KDirWatch::deleted, this, &UniversalSettings::trackedFileChanged);
-    connect(KDirWatch::self(), &KDirWatch::dirty, this, &UniversalSettings::trackedFileChanged);
-
     //! this is needed to inform globalshortcuts to update its modifiers tracking
     emit metaPressAndHoldEnabledChanged();
 }
@@ -28,6 +28,7 @@
 #include <QHeaderView>
 #include <QItemSelection>
 #include <QRegularExpression>
+#include <QSet>
 
 // KDE
 #include <KMessageWidget>
@@ -57,6 +58,10 @@ Views::Views(Settings::Handler::ViewsHandler *parent)
 
     connect(m_handler, &Handler::ViewsHandler::currentLayoutChanged, this, &Views::onCurrentLayoutChanged);
 
+    m_errorsWarningsTimer.setInterval(0);
+    m_errorsWarningsTimer.setSingleShot(true);
+    connect(&m_errorsWarningsTimer, &QTimer::timeout, this, &Views::updateScheduledErrorsWarnings);
+
     init();
 }
 
@@ -368,7 +373,15 @@ void Views::removeSelectedViews()
 
 void Views::selectRow(const QString &id)
 {
-    m_view->selectRow(rowForId(id));
+    int row = rowForId(id);
+
+    if (row < 0 && m_model->canFetchMore(QModelIndex())) {
+        //! the view may not have been fetched yet
+        m_model->fetchAll();
+        row = rowForId(id);
+    }
+
+    m_view->selectRow(row);
 }
 
 void Views::onCurrentLayoutChanged()
@@ -407,7 +420,18 @@ void Views::onCurrentLayoutChanged()
         });
     }
 
-    messagesForErrorsWarnings(currentlayout);
+    m_model->clearErrorsAndWarnings();
+    m_errorsWarningsLayoutId = currentlayoutdata.id;
+    m_errorsWarningsTimer.start();
+}
+
+void Views::updateScheduledErrorsWarnings()
+{
+    if (m_errorsWarningsLayoutId != m_handler->currentData().id) {
+        return;
+    }
+
+    messagesForErrorsWarnings(m_handler->layoutsController()->centralLayout(m_errorsWarningsLayoutId));
 }
 
 void Views::onSelectionsChanged()
@@ -462,29 +486,63 @@ void Views::updateDoubledMoveDestinationRows() {
     //! all the rest that have been created through Cut/Paste or Duplicate options should become
     //! simple OriginFromViewTemplate cases
 
+    QSet<QString> moveorigins;
+
     for (int i=0; i<m_model->rowCount(); ++i) {
-        Data::View baseview = m_model->at(i);
+        Data::View view = m_model->at(i);
+
+        if (!view.isMoveDestination || view.state()!=Data::View::OriginFromLayout) {
+            continue;
+        }
+
+        QString origin = view.originFile() + QLatin1Char('\n') + view.originLayout() + QLatin1Char('\n') + view.originView();
 
-        if (!baseview.isMoveDestination || baseview.state()!=Data::View::OriginFromLayout) {
+        if (!moveorigins.contains(origin)) {
+            moveorigins << origin;
             continue;
         }
 
-        for (int j=i+1; j<m_model->rowCount(); ++j) {
-            Data::View subsequentview = m_model->at(j);
-
-            if (subsequentview.isMoveDestination
-                    && subsequentview.state() == Data::View::OriginFromLayout
-                    && subsequentview.originFile() == baseview.originFile()
-                    && subsequentview.originLayout() == baseview.originLayout()
-                    && subsequentview.originView() == baseview.originView()) {
-                //! this is a subsequent view that needs to be updated properly
-                subsequentview.isMoveDestination = false;
-                subsequentview.isMoveOrigin = false;
-                subsequentview.setState(Data::View::OriginFromViewTemplate, subsequentview.originFile(), QString(), QString());
-                m_model->updateCurrentView(subsequentview.id, subsequentview);
+        //! this is a subsequent view that needs to be updated properly
+        view.isMoveDestination = false;
+        view.isMoveOrigin = false;
+        view.setState(Data::View::OriginFromViewTemplate, view.originFile(), QString(), QString());
+        m_model->updateCurrentView(view.id, view);
+    }
+}
+
+QHash<QString, int> Views::issuesPerView(const Data::ErrorsList &issues) const
+{
+    QHash<QString, int> counts;
+
+    //! one step back from subcontainment to view in order to find the influenced view id
+    QHash<QString, QString> subcontainmentviews;
+    const Data::ViewsTable &views = m_model->currentViewsData();
+
+    for (int i=0; i<views.rowCount(); ++i) {
+        for (int j=0; j<views[i].subcontainments.rowCount(); ++j) {
+            subcontainmentviews[views[i].subcontainments[j].id] = views[i].id;
+        }
+    }
+
+    for (int i=0; i<issues.count(); ++i) {
+        for (int j=0; j<issues[i].information.rowCount(); ++j) {
+            if (!issues[i].information[j].containment.isValid()) {
+                continue;
+            }
+
+            QString cid = issues[i].information[j].containment.storageId;
+
+            if (!views.containsId(cid)) {
+                cid = subcontainmentviews.value(cid);
+            }
+
+            if (!cid.isEmpty()) {
+                counts[cid]++;
             }
         }
     }
+
+    return counts;
 }
 
 void Views::messagesForErrorsWarnings(const NSE::CentralLayout *centralLayout, const bool &showNoErrorsMessage)
@@ -493,14 +551,15 @@ void Views::messagesForErrorsWarnings(const NSE::CentralLayout *centralLayout, c
         return;
     }
 
-    Data::Layout currentdata = centralLayout->data();
+    //! layout data are not used because they would scan the layout for errors and warnings twice
+    QString layoutid = centralLayout->file();
+    Data::ErrorsList errors = centralLayout->errors();
+    Data::WarningsList warnings = centralLayout->warnings();
 
     m_model->clearErrorsAndWarnings();
 
     //! warnings
-    if (currentdata.warnings > 0) {
-        Data::WarningsList warnings = centralLayout->warnings();
-
+    if (warnings.count() > 0) {
         // show warnings
         for (int i=0; i< warnings.count(); ++i) {
             if (warnings[i].id == Data::Warning::ORPHANEDSUBCONTAINMENT) {
@@ -509,34 +568,10 @@ void Views::messagesForErrorsWarnings(const NSE::CentralLayout *centralLayout, c
                 messageForWarningAppletAndContainmentWithSameId(warnings[i]);
             }
         }
-
-        // count warnings per view
-        for (int i=0; i<warnings.count(); ++i) {
-            for (int j=0; j<warnings[i].information.rowCount(); ++j) {
-                if (!warnings[i].information[j].containment.isValid()) {
-                    continue;
-                }
-
-                QString cid = warnings[i].information[j].containment.storageId;
-                Data::View view = m_model->currentData(cid);
-                if (!view.isValid()) {
-                    //! one step back from subcontainment to view in order to find the influenced view id
-                    cid = m_model->viewForSubContainment(cid);
-                    view = m_model->currentData(cid);
-                }
-
-                if (view.isValid()) {
-                    view.warnings++;
-                    m_model->updateCurrentView(cid, view);
-                }
-            }
-        }
     }
 
     //! errors
-    if (currentdata.errors > 0) {
-        Data::ErrorsList errors = centralLayout->errors();
-
+    if (errors.count() > 0) {
         // show errors
         for (int i=0; i< errors.count(); ++i) {
             if (errors[i].id == Data::Error::APPLETSWITHSAMEID) {
@@ -545,33 +580,33 @@ void Views::messagesForErrorsWarnings(const NSE::CentralLayout *centralLayout, c
                 messageForErrorOrphanedParentAppletOfSubContainment(errors[i]);
             }
         }
+    }
 
-        // count errors per view
-        for (int i=0; i<errors.count(); ++i) {
-            for (int j=0; j<errors[i].information.rowCount(); ++j) {
-                if (!errors[i].information[j].containment.isValid()) {
-                    continue;
-                }
-
-                QString cid = errors[i].information[j].containment.storageId;
-                Data::View view = m_model->currentData(cid);
-                if (!view.isValid()) {
-                    //! one step back from subcontainment to view in order to find the influenced view id
-                    cid = m_model->viewForSubContainment(cid);
-                    view = m_model->currentData(cid);
-                }
-
-                if (view.isValid()) {
-                    view.errors++;
-                    m_model->updateCurrentView(cid, view);
-                }
-            }
+    //! count errors and warnings per view and update each view once
+    const QHash<QString, int> warningsperview = issuesPerView(warnings);
+    const QHash<QString, int> errorsperview = issuesPerView(errors);
+
+    QSet<QString> influencedviews;
+    for (auto it = warningsperview.cbegin(); it != warningsperview.cend(); ++it) {
+        influencedviews << it.key();
+    }
+    for (auto it = errorsperview.cbegin(); it != errorsperview.cend(); ++it) {
+        influencedviews << it.key();
+    }
+
+    for (const auto &vid : influencedviews) {
+        Data::View view = m_model->currentData(vid);
+
+        if (view.isValid()) {
+            view.warnings += warningsperview.value(vid);
+            view.errors += errorsperview.value(vid);
+            m_model->updateCurrentView(vid, view);
         }
     }
 
-    m_handler->layoutsController()->setLayoutCurrentErrorsWarnings(currentdata.id, currentdata.errors, currentdata.warnings);
+    m_handler->layoutsController()->setLayoutCurrentErrorsWarnings(layoutid, errors.count(), warnings.count());
 
-    if (showNoErrorsMessage && currentdata.errors == 0 && currentdata.warnings == 0) {
+    if (showNoErrorsMessage && errors.count() == 0 && warnings.count() == 0) {
         m_handler->showInlineMessage(i18n("Really nice! You are good to go, your layout does not report any errors or warnings."),
                                      KMessageWidget::Positive,
                                      false);
@@ -10,6 +10,7 @@
 #include <coretypes.h>
 #include "viewsmodel.h"
 #include "../../nsecoronainterface.h"
+#include "../../data/errordata.h"
 #include "../../data/viewdata.h"
 #include "../../data/viewstable.h"
 
@@ -21,6 +22,7 @@
 #include <QMetaObject>
 #include <QSortFilterProxyModel>
 #include <QTableView>
+#include <QTimer>
 
 // KDE
 #include <KMessageWidget>
@@ -98,6 +100,7 @@ private:
     Data::ViewsTable selectedViewsForClipboard();
 
     //! errors/warnings
+    QHash<QString, int> issuesPerView(const Data::ErrorsList &issues) const;
     void messagesForErrorsWarnings(const NSE::CentralLayout *centralLayout, const bool &showNoErrorsMessage = false);
     void messageForErrorAppletsWithSameId(const Data::Error &error);
     void messageForErrorOrphanedParentAppletOfSubContainment(const Data::Error &error);
@@ -121,6 +124,7 @@ private slots:
     void onSelectionsChanged();
 
     void updateDoubledMoveDestinationRows();
+    void updateScheduledErrorsWarnings();
 
 private:
     Settings::Handler::ViewsHandler *m_handler{nullptr};
@@ -132,6 +136,11 @@ private:
     //! current active layout signals/slots
     QList<QMetaObject::Connection> m_currentLayoutConnections;
 
+    //! layout errors/warnings are scanned after the views have been shown,
+    //! fast layout selection changes are coalesced to the last one
+    QString m_errorsWarningsLayoutId;
+    QTimer m_errorsWarningsTimer;
+
     //! layoutsView ui settings
     int m_viewSortColumn{Model::Views::SCREENCOLUMN};
     Qt::SortOrder m_viewSortOrder;
@@ -51,7 +51,7 @@ int Views::columnCount()
 int Views::rowCount(const QModelIndex &parent) const
 {
     Q_UNUSED(parent);
-    return m_viewsTable.rowCount();
+    return m_fetchedRows;
 }
 
 int Views::columnCount(const QModelIndex &parent) const
@@ -60,6 +60,40 @@ int Views::columnCount(const QModelIndex &parent) const
     return columnCount();
 }
 
+bool Views::canFetchMore(const QModelIndex &parent) const
+{
+    return !parent.isValid() && m_fetchedRows < m_viewsTable.rowCount();
+}
+
+void Views::fetchMore(const QModelIndex &parent)
+{
+    if (!canFetchMore(parent)) {
+        return;
+    }
+
+    int count = qMin(FETCHBATCHSIZE, m_viewsTable.rowCount() - m_fetchedRows);
+
+    beginInsertRows(QModelIndex(), m_fetchedRows, m_fetchedRows + count - 1);
+    m_fetchedRows += count;
+    endInsertRows();
+}
+
+void Views::fetchAll()
+{
+    if (!canFetchMore(QModelIndex())) {
+        return;
+    }
+
+    beginInsertRows(QModelIndex(), m_fetchedRows, m_viewsTable.rowCount() - 1);
+    m_fetchedRows = m_viewsTable.rowCount();
+    endInsertRows();
+}
+
+bool Views::isFetched(const int &row) const
+{
+    return row >= 0 && row < m_fetchedRows;
+}
+
 int Views::rowForId(const QString &id) const
 {
     return m_viewsTable.indexOf(id);
@@ -175,10 +209,13 @@ QString Views::sortableText(const int &priority, const QString &text) const
 
 void Views::clear()
 {
-    if (m_viewsTable.rowCount() > 0) {
-        beginRemoveRows(QModelIndex(), 0, m_viewsTable.rowCount() - 1);
+    if (m_fetchedRows > 0) {
+        beginRemoveRows(QModelIndex(), 0, m_fetchedRows - 1);
         m_viewsTable.clear();
+        m_fetchedRows = 0;
         endRemoveRows();
+    } else {
+        m_viewsTable.clear();
     }
 }
 
@@ -338,8 +375,12 @@ void Views::appendTemporaryView(const NSE::Data::View &view)
 {
     //int newRow = m_layoutsTable.sortedPosForName(layout.name);
 
+    //! new views are appended at the end and must be visible immediately
+    fetchAll();
+
     beginInsertRows(QModelIndex(), m_viewsTable.rowCount(), m_viewsTable.rowCount());
     m_viewsTable.appendTemporaryView(view);
+    m_fetchedRows = m_viewsTable.rowCount();
     endInsertRows();
 
     emit rowsInserted();
@@ -363,10 +404,15 @@ bool Views::removeRows(int row, int count, const QModelIndex &parent)
     int lastRow = row+count-1;
 
     if (count > 0 && m_viewsTable.rowExists(firstRow) && (m_viewsTable.rowExists(lastRow))) {
+        if (!isFetched(lastRow)) {
+            fetchAll();
+        }
+
         beginRemoveRows(QModelIndex(), firstRow, lastRow);
         for(int i=0; i<count; ++i) {
             m_viewsTable.remove(firstRow);
         }
+        m_fetchedRows -= count;
         endRemoveRows();
         return true;
     }
@@ -411,7 +457,10 @@ void Views::updateActiveStatesBasedOn(const CentralLayout *layout)
 
         if (currentactivestate != m_viewsTable[i].isActive) {
             m_viewsTable[i].isActive = currentactivestate;
-            emit dataChanged(this->index(i, IDCOLUMN), this->index(i, SUBCONTAINMENTSCOLUMN), roles);
+
+            if (isFetched(i)) {
+                emit dataChanged(this->index(i, IDCOLUMN), this->index(i, SUBCONTAINMENTSCOLUMN), roles);
+            }
         }
     }
 }
@@ -490,7 +539,9 @@ void Views::clearErrorsAndWarnings()
     roles << ERRORSROLE;
     roles << WARNINGSROLE;
 
-    emit dataChanged(this->index(0, IDCOLUMN), this->index(m_viewsTable.rowCount()-1, SUBCONTAINMENTSCOLUMN), roles);
+    if (m_fetchedRows > 0) {
+        emit dataChanged(this->index(0, IDCOLUMN), this->index(m_fetchedRows-1, SUBCONTAINMENTSCOLUMN), roles);
+    }
 }
 
 void Views::populateScreens()
@@ -534,7 +585,9 @@ void Views::updateCurrentView(QString currentViewId, NSE::Data::View &view)
     roles << ERRORSROLE;
     roles << WARNINGSROLE;
 
-    emit dataChanged(this->index(currentrow, IDCOLUMN), this->index(currentrow, SUBCONTAINMENTSCOLUMN), roles);
+    if (isFetched(currentrow)) {
+        emit dataChanged(this->index(currentrow, IDCOLUMN), this->index(currentrow, SUBCONTAINMENTSCOLUMN), roles);
+    }
 }
 
 void Views::setOriginalView(QString currentViewId, NSE::Data::View &view)
@@ -554,17 +607,19 @@ void Views::setOriginalView(QString currentViewId, NSE::Data::View &view)
     roles << ISACTIVEROLE;
     roles << HASCHANGEDVIEWROLE;
 
-    emit dataChanged(this->index(currentrow, IDCOLUMN), this->index(currentrow, SUBCONTAINMENTSCOLUMN), roles);
+    if (isFetched(currentrow)) {
+        emit dataChanged(this->index(currentrow, IDCOLUMN), this->index(currentrow, SUBCONTAINMENTSCOLUMN), roles);
+    }
 }
 
 void Views::setOriginalData(NSE::Data::ViewsTable &data)
 {
     clear();
 
-    beginInsertRows(QModelIndex(), 0, data.rowCount() - 1);
+    //! rows are exposed to item views in batches through fetchMore()
     o_viewsTable = data;
     m_viewsTable = data;
-    endInsertRows();
+    fetchMore(QModelIndex());
 
     emit rowsInserted();
 }
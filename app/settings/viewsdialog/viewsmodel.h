@@ -79,11 +79,17 @@ public:
     void appendTemporaryView(const NSE::Data::View &view);
     void removeView(const QString &id);
 
+    //! all views of the layout, including the ones that have not been fetched yet
     int rowCount() const;
     static int columnCount();
+    //! only fetched views are exposed to item views
     int rowCount(const QModelIndex &parent) const override;
     int columnCount(const QModelIndex &parent) const override;
 
+    bool canFetchMore(const QModelIndex &parent) const override;
+    void fetchMore(const QModelIndex &parent) override;
+    void fetchAll();
+
     QVariant data(const QModelIndex &index, int role) const override;
     QVariant headerData(int section, Qt::Orientation orientation, int role) const override;
     Qt::ItemFlags flags(const QModelIndex &index) const override;
@@ -140,7 +146,13 @@ private:
 
     NSE::Data::Screen screenData(const QString &viewId) const;
 
+    bool isFetched(const int &row) const;
+
 private:
+    static const int FETCHBATCHSIZE = 32;
+
+    int m_fetchedRows{0};
+
     NSE::Data::ViewsTable m_viewsTable;
     NSE::Data::ViewsTable o_viewsTable;
 
@@ -11,6 +11,7 @@
 #include "modifiertracker.h"
 #include "shortcutstracker.h"
 #include "../nsecoronainterface.h"
+#include "../screenpool.h"
 #include "../layout/centrallayout.h"
 #include "../layouts/manager.h"
 #include "../layouts/synchronizer.h"
@@ -25,11 +26,13 @@
 // Qt
 #include <QAction>
 #include <QDebug>
+#include <QGuiApplication>
 #include <QQuickItem>
 #include <QMetaMethod>
 
 // KDE
 #include <KActionCollection>
+#include <KActivities/Consumer>
 #include <KGlobalAccel>
 #include <KLocalizedString>
 #include <KPluginMetaData>
@@ -65,6 +68,13 @@ GlobalShortcuts::GlobalShortcuts(QObject *parent)
     }
 
     connect(&m_hideViewsTimer, &QTimer::timeout, this, &GlobalShortcuts::hideViewsTimerSlot);
+
+    m_badgesTimer.setInterval(BADGESINTERVAL);
+    m_badgesTimer.setSingleShot(true);
+    connect(&m_badgesTimer, &QTimer::timeout, this, &GlobalShortcuts::publishPendingBadges);
+
+    connect(qGuiApp, &QGuiApplication::screenAdded, this, &GlobalShortcuts::invalidateShortcutsRoute);
+    connect(qGuiApp, &QGuiApplication::screenRemoved, this, &GlobalShortcuts::invalidateShortcutsRoute);
 }
 
 GlobalShortcuts::~GlobalShortcuts()
@@ -194,6 +204,52 @@ ShortcutsPart::ShortcutsTracker *GlobalShortcuts::shortcutsTracker() const
     return m_shortcutsTracker;
 }
 
+void GlobalShortcuts::invalidateShortcutsRoute()
+{
+    m_shortcutsRouteIsDirty = true;
+}
+
+QList<NSE::View *> GlobalShortcuts::shortcutsRoute()
+{
+    if (m_shortcutsRouteIsDirty) {
+        m_shortcutsRouteIsDirty = false;
+        m_shortcutsRoute.clear();
+
+        Layouts::Synchronizer *synchronizer = m_corona->layoutsManager()->synchronizer();
+
+        connect(synchronizer, &Layouts::Synchronizer::centralLayoutsChanged, this, &GlobalShortcuts::invalidateShortcutsRoute, Qt::UniqueConnection);
+        //! in multiple layouts mode the current layouts follow the current activity
+        connect(synchronizer, &Layouts::Synchronizer::layoutActivitiesChanged, this, &GlobalShortcuts::invalidateShortcutsRoute, Qt::UniqueConnection);
+        connect(m_corona->activitiesConsumer(), &KActivities::Consumer::currentActivityChanged, this, &GlobalShortcuts::invalidateShortcutsRoute, Qt::UniqueConnection);
+        connect(m_corona->screenPool(), &ScreenPool::primaryScreenChanged, this, &GlobalShortcuts::invalidateShortcutsRoute, Qt::UniqueConnection);
+
+        for (const auto layout : synchronizer->currentLayouts()) {
+            connect(layout, &Layout::GenericLayout::viewsCountChanged, this, &GlobalShortcuts::invalidateShortcutsRoute, Qt::UniqueConnection);
+            connect(layout, &Layout::GenericLayout::viewEdgeChanged, this, &GlobalShortcuts::invalidateShortcutsRoute, Qt::UniqueConnection);
+            connect(layout, &Layout::GenericLayout::preferredViewForShortcutsChanged, this, &GlobalShortcuts::invalidateShortcutsRoute, Qt::UniqueConnection);
+        }
+
+        for (const auto view : synchronizer->sortedCurrentViews()) {
+            connect(view, &QWindow::screenChanged, this, &GlobalShortcuts::invalidateShortcutsRoute, Qt::UniqueConnection);
+            connect(view, &NSE::View::isPreferredForShortcutsChanged, this, &GlobalShortcuts::invalidateShortcutsRoute, Qt::UniqueConnection);
+            connect(view->extendedInterface(), &ViewPart::ContainmentInterface::hasLatteTasksChanged, this, &GlobalShortcuts::invalidateShortcutsRoute, Qt::UniqueConnection);
+            connect(view->extendedInterface(), &ViewPart::ContainmentInterface::hasPlasmaTasksChanged, this, &GlobalShortcuts::invalidateShortcutsRoute, Qt::UniqueConnection);
+
+            m_shortcutsRoute << view;
+        }
+    }
+
+    QList<NSE::View *> route;
+
+    for (const auto &view : m_shortcutsRoute) {
+        if (view) {
+            route << view;
+        }
+    }
+
+    return route;
+}
+
 NSE::View *GlobalShortcuts::highestApplicationLauncherView(const QList<NSE::View *> &views) const
 {
     if (views.isEmpty()) {
@@ -228,9 +284,7 @@ void GlobalShortcuts::activateLauncherMenu()
         return;
     }
 
-    QList<NSE::View *> sortedViews = m_corona->layoutsManager()->synchronizer()->sortedCurrentViews();
-
-    NSE::View *highestPriorityView = highestApplicationLauncherView(sortedViews);
+    NSE::View *highestPriorityView = highestApplicationLauncherView(shortcutsRoute());
 
     if (highestPriorityView) {
         if (!highestPriorityView->visibility()->isShownFully() && highestPriorityView->extendedInterface()->applicationLauncherInPopup()) {
@@ -288,10 +342,15 @@ bool GlobalShortcuts::activateLatteEntry(NSE::View *view, int index, Qt::Key mod
     bool activation{modifier == static_cast<Qt::Key>(Qt::META)};
     bool newInstance{!activation};
 
-    int appletId = view->extendedInterface()->appletIdForVisualIndex(index);
-    bool hasPopUp {(appletId>-1 && view->extendedInterface()->appletIsExpandable(appletId))};
+    bool hasPopUp{false};
 
-    if (!view->visibility()->isShownFully() && hasPopUp) {
+    //! the entry applet matters only when its popup must wait for the view to be shown
+    if (!view->visibility()->isShownFully()) {
+        int appletId = view->extendedInterface()->appletIdForVisualIndex(index);
+        hasPopUp = (appletId>-1 && view->extendedInterface()->appletIsExpandable(appletId));
+    }
+
+    if (hasPopUp) {
         //! wait for view to fully shown
         connect(view->visibility(), &NSE::ViewPart::VisibilityManager::isShownFullyChanged, this, [&, view, index, activation](){
             if (view->visibility()->isShownFully()) {
@@ -348,24 +407,23 @@ void GlobalShortcuts::activateEntry(int index, Qt::Key modifier)
 {
     m_lastInvokedAction = dynamic_cast<QAction *>(sender());
 
-    QList<NSE::View *> sortedViews = m_corona->layoutsManager()->synchronizer()->sortedCurrentViews();
+    const QList<NSE::View *> route = shortcutsRoute();
 
-    NSE::View *highest{nullptr};
+    if (route.isEmpty()) {
+        return;
+    }
 
-    for (const auto view : sortedViews) {
-        if (view->isPreferredForShortcuts()) {
-            highest = view;
-            break;
-        }
+    //! the view preferred for shortcuts is always first in route
+    if (route.first()->isPreferredForShortcuts()) {
+        activateEntryForView(route.first(), index, modifier);
+        return;
     }
 
-    if (highest) {
-        activateEntryForView(highest, index, modifier);
-    } else {
-        for (const auto view : sortedViews) {
-            if (activateEntryForView(view, index, modifier)) {
-                return;
-            }
+    //! entry indexing is owned by the qml hosts of each view, the first view in route whose
+    //! host is available serves the entry, so a key press is one call into qml
+    for (const auto view : route) {
+        if (activateEntryForView(view, index, modifier)) {
+            return;
         }
     }
 }
@@ -373,11 +431,33 @@ void GlobalShortcuts::activateEntry(int index, Qt::Key modifier)
 //! update badge for specific view item
 void GlobalShortcuts::updateViewItemBadge(QString identifier, QString value)
 {
+    m_pendingBadges[identifier] = value;
+
+    if (!m_badgesTimer.isActive()) {
+        m_badgesTimer.start();
+    }
+}
+
+void GlobalShortcuts::publishPendingBadges()
+{
+    if (m_pendingBadges.isEmpty()) {
+        return;
+    }
+
+    const QHash<QString, QString> badges = m_pendingBadges;
+    m_pendingBadges.clear();
+
     QList<NSE::View *> views = m_corona->layoutsManager()->synchronizer()->currentViews();
 
     // update badges in all Latte Tasks plasmoids
     for (const auto &view : views) {
-        view->extendedInterface()->updateBadgeForLatteTask(identifier, value);
+        if (!view->extendedInterface()->hasLatteTasks()) {
+            continue;
+        }
+
+        for (auto it = badges.constBegin(); it != badges.constEnd(); ++it) {
+            view->extendedInterface()->updateBadgeForLatteTask(it.key(), it.value());
+        }
     }
 }
 
@@ -389,28 +469,12 @@ void GlobalShortcuts::showViews()
         m_lastInvokedAction = m_singleMetaAction;
     }
 
-    QList<NSE::View *> sortedViews = m_corona->layoutsManager()->synchronizer()->sortedCurrentViews();
+    const QList<NSE::View *> sortedViews = shortcutsRoute();
 
-    NSE::View *viewWithTasks{nullptr};
+    //! the view preferred for shortcuts is always first in route
+    NSE::View *viewWithTasks{sortedViews.isEmpty() ? nullptr : sortedViews.first()};
     NSE::View *viewWithMeta{nullptr};
 
-    bool hasPreferredForShortcutsView{false};
-
-    for (const auto view : sortedViews) {
-        if (view->isPreferredForShortcuts()) {
-            hasPreferredForShortcutsView = true;
-            break;
-        }
-    }
-
-    for(const auto view : sortedViews) {
-        if (!viewWithTasks
-                && (!hasPreferredForShortcutsView || view->isPreferredForShortcuts())) {
-            viewWithTasks = view;
-            break;
-        }
-    }
-
     if (m_corona->universalSettings()->kwin_metaForwardedToLatte()) {
         viewWithMeta = highestApplicationLauncherView(sortedViews);
     }
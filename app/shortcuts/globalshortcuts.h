@@ -40,6 +40,8 @@ class GlobalShortcuts : public QObject
 
 public:
     static constexpr const char* SHORTCUTBLOCKHIDINGTYPE  = "globalshortcuts::blockHiding()";
+    //! badge updates arriving in bursts for the same identifier are delivered once, with the latest value
+    static constexpr int BADGESINTERVAL = 50;
 
     GlobalShortcuts(QObject *parent = nullptr);
     ~GlobalShortcuts() override;
@@ -54,6 +56,8 @@ signals:
 
 private slots:
     void hideViewsTimerSlot();
+    void invalidateShortcutsRoute();
+    void publishPendingBadges();
 
 private:
     void init();
@@ -69,6 +73,9 @@ private:
     bool viewAtLowerScreenPriority(NSE::View *test, NSE::View *base);
     bool viewsToHideAreValid();
 
+    //! views in shortcuts priority order, rebuilt only after views, screens, edges or tasks changed
+    QList<NSE::View *> shortcutsRoute();
+
     //! highest priority application launcher view
     NSE::View *highestApplicationLauncherView(const QList<NSE::View *> &views) const;
 
@@ -76,6 +83,7 @@ private:
 
 private:
     bool m_metaShowedViews{false};
+    bool m_shortcutsRouteIsDirty{true};
 
     //! last action that was triggered from the user
     QAction *m_lastInvokedAction;
@@ -86,6 +94,11 @@ private:
     QTimer m_hideViewsTimer;
     QList<NSE::View *> m_hideViews;
 
+    //! badge values per launcher identifier that have not been delivered yet
+    QHash<QString, QString> m_pendingBadges;
+    QTimer m_badgesTimer;
+
+    QList<QPointer<NSE::View>> m_shortcutsRoute;
     QPointer<ShortcutsPart::ModifierTracker> m_modifierTracker;
     QPointer<ShortcutsPart::ShortcutsTracker> m_shortcutsTracker;
     QPointer<NSE::Corona> m_corona;
@@ -6,6 +6,7 @@
 // local
 #include "shortcutstracker.h"
 #include "../tools/commontools.h"
+#include "../tools/filewatchrouter.h"
 
 // Qt
 #include <QAction>
@@ -15,7 +16,6 @@
 
 // KDE
 #include <KConfigGroup>
-#include <KDirWatch>
 #include <KGlobalAccel>
 
 
@@ -47,10 +47,11 @@ void ShortcutsTracker::initGlobalShortcutsWatcher()
     const QString globalShortcutsFilePath = NSE::configPath() + "/" + GLOBALSHORTCUTSCONFIG;
     m_shortcutsConfigPtr = KSharedConfig::openConfig(globalShortcutsFilePath);
 
-    KDirWatch::self()->addFile(globalShortcutsFilePath);
-
-    connect(KDirWatch::self(), &KDirWatch::dirty, this, &ShortcutsTracker::shortcutsFileChanged, Qt::QueuedConnection);
-    connect(KDirWatch::self(), &KDirWatch::created, this, &ShortcutsTracker::shortcutsFileChanged, Qt::QueuedConnection);
+    FileWatchRouter::self()->watchFile(this, globalShortcutsFilePath, [&](const QString &path, FileWatchRouter::Changes changes) {
+        if (changes & (FileWatchRouter::Dirty | FileWatchRouter::Created)) {
+            shortcutsFileChanged(path);
+        }
+    });
 }
 
 bool ShortcutsTracker::basedOnPositionEnabled() const
@@ -12,6 +12,7 @@
 #include "../layouts/manager.h"
 #include "../layouts/storage.h"
 #include "../tools/commontools.h"
+#include "../tools/filewatchrouter.h"
 #include "../view/view.h"
 
 // Qt
@@ -29,10 +30,9 @@ Manager::Manager(NSE::Corona *corona)
     : QObject(corona),
       m_corona(corona)
 {
-    KDirWatch::self()->addDir(NSE::configPath() + "/latte/templates", KDirWatch::WatchFiles);
-    connect(KDirWatch::self(), &KDirWatch::created, this, &Manager::onCustomTemplatesCountChanged);
-    connect(KDirWatch::self(), &KDirWatch::deleted, this, &Manager::onCustomTemplatesCountChanged);
-    connect(KDirWatch::self(), &KDirWatch::dirty, this, &Manager::onCustomTemplatesCountChanged);
+    FileWatchRouter::self()->watchDir(this, NSE::configPath() + "/latte/templates", [&](const QString &path, FileWatchRouter::Changes) {
+        onCustomTemplatesCountChanged(path);
+    }, KDirWatch::WatchFiles);
 }
 
 Manager::~Manager()
@@ -0,0 +1,195 @@
+/* This file is a part of the Atmo desktop experience's SynDock project for SynOS.
+ * Copyright (C) 2026 Syndromatic Ltd. All rights reserved
+ * Designed by Kavish Krishnakumar in Manchester.
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+#include "filewatchrouter.h"
+
+// Qt
+#include <QFileInfo>
+
+//! changes of the same path within this interval are delivered together
+#define DELIVERINTERVAL 16
+
+namespace NSE {
+
+FileWatchRouter::FileWatchRouter()
+    : QObject(nullptr)
+{
+    m_deliverTimer.setInterval(DELIVERINTERVAL);
+    m_deliverTimer.setSingleShot(true);
+    connect(&m_deliverTimer, &QTimer::timeout, this, &FileWatchRouter::deliver);
+
+    connect(KDirWatch::self(), &KDirWatch::dirty, this, [this](const QString &path) {
+        queue(path, Dirty);
+    });
+
+    connect(KDirWatch::self(), &KDirWatch::created, this, [this](const QString &path) {
+        queue(path, Created);
+    });
+
+    connect(KDirWatch::self(), &KDirWatch::deleted, this, [this](const QString &path) {
+        queue(path, Deleted);
+    });
+}
+
+FileWatchRouter::~FileWatchRouter()
+{
+}
+
+FileWatchRouter *FileWatchRouter::self()
+{
+    static FileWatchRouter router;
+    return &router;
+}
+
+quint64 FileWatchRouter::suppressedNotifications() const
+{
+    return m_suppressedNotifications;
+}
+
+int FileWatchRouter::watchFile(QObject *receiver, const QString &file, Handler handler)
+{
+    int id = addRegistration(receiver, file, false, false, std::move(handler));
+
+    if (id > 0) {
+        KDirWatch::self()->addFile(file);
+    }
+
+    return id;
+}
+
+int FileWatchRouter::watchDir(QObject *receiver, const QString &dir, Handler handler, KDirWatch::WatchModes mode)
+{
+    int id = addRegistration(receiver, dir, true, mode.testFlag(KDirWatch::WatchFiles), std::move(handler));
+
+    if (id > 0) {
+        KDirWatch::self()->addDir(dir, mode);
+    }
+
+    return id;
+}
+
+int FileWatchRouter::addRegistration(QObject *receiver, const QString &path, bool isDir, bool watchesFiles, Handler handler)
+{
+    if (!receiver || path.isEmpty() || !handler) {
+        return 0;
+    }
+
+    Registration registration;
+    registration.id = ++m_lastId;
+    registration.isDir = isDir;
+    registration.watchesFiles = watchesFiles;
+    registration.path = path;
+    registration.receiver = receiver;
+    registration.handler = std::move(handler);
+
+    m_routes[path] << registration;
+
+    connect(receiver, &QObject::destroyed, this, &FileWatchRouter::onReceiverDestroyed, Qt::UniqueConnection);
+
+    return registration.id;
+}
+
+void FileWatchRouter::removeRegistration(const Registration &registration)
+{
+    if (registration.isDir) {
+        KDirWatch::self()->removeDir(registration.path);
+    } else {
+        KDirWatch::self()->removeFile(registration.path);
+    }
+}
+
+void FileWatchRouter::unwatch(int id)
+{
+    for (auto it = m_routes.begin(); it != m_routes.end(); ++it) {
+        for (int i = 0; i < it.value().count(); ++i) {
+            if (it.value()[i].id == id) {
+                removeRegistration(it.value()[i]);
+                it.value().removeAt(i);
+
+                if (it.value().isEmpty()) {
+                    m_routes.erase(it);
+                }
+
+                return;
+            }
+        }
+    }
+}
+
+void FileWatchRouter::onReceiverDestroyed(QObject *receiver)
+{
+    for (auto it = m_routes.begin(); it != m_routes.end();) {
+        it.value().removeIf([this, receiver](const Registration &registration) {
+            //! the QPointer is already cleared at this point
+            if (registration.receiver && registration.receiver != receiver) {
+                return false;
+            }
+
+            removeRegistration(registration);
+            return true;
+        });
+
+        if (it.value().isEmpty()) {
+            it = m_routes.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+QList<FileWatchRouter::Registration> FileWatchRouter::registrationsFor(const QString &path) const
+{
+    QList<Registration> registrations = m_routes.value(path);
+
+    //! files inside directories that are watched with KDirWatch::WatchFiles are routed also to their directory
+    const QString dir = QFileInfo(path).absolutePath();
+
+    if (dir != path && m_routes.contains(dir)) {
+        for (const auto &registration : m_routes[dir]) {
+            if (registration.watchesFiles) {
+                registrations << registration;
+            }
+        }
+    }
+
+    return registrations;
+}
+
+void FileWatchRouter::queue(const QString &path, Change change)
+{
+    //! KDirWatch is shared with the frameworks, paths nobody registered for are ignored
+    if (registrationsFor(path).isEmpty()) {
+        return;
+    }
+
+    if (m_pendingChanges.contains(path)) {
+        ++m_suppressedNotifications;
+        m_pendingChanges[path] |= change;
+        return;
+    }
+
+    m_pendingChanges[path] = change;
+
+    if (!m_deliverTimer.isActive()) {
+        m_deliverTimer.start();
+    }
+}
+
+void FileWatchRouter::deliver()
+{
+    const QHash<QString, Changes> changes = m_pendingChanges;
+    m_pendingChanges.clear();
+
+    for (auto it = changes.constBegin(); it != changes.constEnd(); ++it) {
+        for (const auto &registration : registrationsFor(it.key())) {
+            if (registration.receiver) {
+                registration.handler(it.key(), it.value());
+            }
+        }
+    }
+}
+
+}
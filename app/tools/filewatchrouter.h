@@ -0,0 +1,93 @@
+/* This file is a part of the Atmo desktop experience's SynDock project for SynOS.
+ * Copyright (C) 2026 Syndromatic Ltd. All rights reserved
+ * Designed by Kavish Krishnakumar in Manchester.
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+#ifndef FILEWATCHROUTER_H
+#define FILEWATCHROUTER_H
+
+// Qt
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QPointer>
+#include <QString>
+#include <QTimer>
+
+// KDE
+#include <KDirWatch>
+
+// C++
+#include <functional>
+
+namespace NSE {
+
+//! Shares KDirWatch between all file trackers of the application. Every change is
+//! delivered only to the handlers registered for its path, and changes of the same
+//! path that arrive within a frame are delivered once with their accumulated flags.
+//! Atomic saves (deleted/created/dirty bursts) therefore trigger a single reparse.
+class FileWatchRouter: public QObject
+{
+    Q_OBJECT
+
+public:
+    enum Change {
+        Dirty = 0x1,
+        Created = 0x2,
+        Deleted = 0x4
+    };
+    Q_DECLARE_FLAGS(Changes, Change)
+
+    using Handler = std::function<void(const QString &path, FileWatchRouter::Changes changes)>;
+
+    static FileWatchRouter *self();
+    ~FileWatchRouter() override;
+
+    //! registrations are removed automatically when their receiver is destroyed
+    int watchFile(QObject *receiver, const QString &file, Handler handler);
+    //! with KDirWatch::WatchFiles the handler receives also the paths of the files in the directory
+    int watchDir(QObject *receiver, const QString &dir, Handler handler, KDirWatch::WatchModes mode = KDirWatch::WatchDirOnly);
+    void unwatch(int id);
+
+    //! notifications that were merged into an already pending change
+    quint64 suppressedNotifications() const;
+
+private slots:
+    void onReceiverDestroyed(QObject *receiver);
+    void deliver();
+
+private:
+    struct Registration {
+        int id{0};
+        bool isDir{false};
+        bool watchesFiles{false};
+        QString path;
+        QPointer<QObject> receiver;
+        Handler handler;
+    };
+
+    FileWatchRouter();
+
+    int addRegistration(QObject *receiver, const QString &path, bool isDir, bool watchesFiles, Handler handler);
+    void removeRegistration(const Registration &registration);
+    QList<Registration> registrationsFor(const QString &path) const;
+    void queue(const QString &path, Change change);
+
+private:
+    int m_lastId{0};
+    quint64 m_suppressedNotifications{0};
+
+    //! registrations per watched path, delivering works on implicitly shared copies so
+    //! handlers can safely unwatch while a change is delivered
+    QHash<QString, QList<Registration>> m_routes;
+    QHash<QString, Changes> m_pendingChanges;
+
+    QTimer m_deliverTimer;
+};
+
+}
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(NSE::FileWatchRouter::Changes)
+
+#endif
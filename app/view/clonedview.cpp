@@ -61,7 +61,7 @@ void ClonedView::initSync()
 
 
     //! Update Applets from Clone -> OriginalView
-    connect(extendedInterface(), &NSE::ViewPart::ContainmentInterface::appletConfigPropertyChanged, this, &ClonedView::updateOriginalAppletConfigProperty);
+    connect(extendedInterface(), &NSE::ViewPart::ContainmentInterface::appletConfigPropertiesChanged, this, &ClonedView::updateOriginalAppletConfigProperties);
     connect(extendedInterface(), &NSE::ViewPart::ContainmentInterface::initializationCompleted, this, &ClonedView::updateAppletIdsHash);
     connect(extendedInterface(), &NSE::ViewPart::ContainmentInterface::appletsOrderChanged, this, &ClonedView::updateAppletIdsHash);
     connect(extendedInterface(), &NSE::ViewPart::ContainmentInterface::appletDataCreated, this, &ClonedView::updateAppletIdsHash);
@@ -75,7 +75,7 @@ void ClonedView::initSync()
 
     //! Update Applets and Containment from OrigalView -> Clone
     connect(m_originalView->extendedInterface(), &NSE::ViewPart::ContainmentInterface::containmentConfigPropertyChanged, this, &ClonedView::updateContainmentConfigProperty);
-    connect(m_originalView->extendedInterface(), &NSE::ViewPart::ContainmentInterface::appletConfigPropertyChanged, this, &ClonedView::onOriginalAppletConfigPropertyChanged);
+    connect(m_originalView->extendedInterface(), &NSE::ViewPart::ContainmentInterface::appletConfigPropertiesChanged, this, &ClonedView::onOriginalAppletConfigPropertiesChanged);
     connect(m_originalView->extendedInterface(), &NSE::ViewPart::ContainmentInterface::appletInScheduledDestructionChanged, this, &ClonedView::onOriginalAppletInScheduledDestructionChanged);
     connect(m_originalView->extendedInterface(), &NSE::ViewPart::ContainmentInterface::appletRemoved, this, &ClonedView::onOriginalAppletRemoved);
     connect(m_originalView->extendedInterface(), &NSE::ViewPart::ContainmentInterface::appletsOrderChanged, this, &ClonedView::onOriginalAppletsOrderChanged);
@@ -258,13 +258,13 @@ void ClonedView::onOriginalAppletRemoved(const int &id)
     m_currentAppletIds.remove(id);
 }
 
-void ClonedView::onOriginalAppletConfigPropertyChanged(const int &id, const QString &key, const QVariant &value)
+void ClonedView::onOriginalAppletConfigPropertiesChanged(const int &id, const QVariantMap &properties)
 {
     if (!m_currentAppletIds.contains(id)) {
         return;
     }
 
-    extendedInterface()->updateAppletConfigProperty(m_currentAppletIds[id], key, value);
+    extendedInterface()->updateAppletConfigProperties(m_currentAppletIds[id], properties);
 }
 
 void ClonedView::onOriginalAppletInScheduledDestructionChanged(const int &id, const bool &enabled)
@@ -285,13 +285,13 @@ void ClonedView::updateContainmentConfigProperty(const QString &key, const QVari
     }
 }
 
-void ClonedView::updateOriginalAppletConfigProperty(const int &clonedid, const QString &key, const QVariant &value)
+void ClonedView::updateOriginalAppletConfigProperties(const int &clonedid, const QVariantMap &properties)
 {
     if (!hasOriginalAppletId(clonedid)) {
         return;
     }
 
-    m_originalView->extendedInterface()->updateAppletConfigProperty(originalAppletId(clonedid), key, value);
+    m_originalView->extendedInterface()->updateAppletConfigProperties(originalAppletId(clonedid), properties);
 }
 
 void ClonedView::onOriginalAppletsOrderChanged()
@@ -41,7 +41,7 @@ protected:
 
 private slots:
     void initSync();
-    void onOriginalAppletConfigPropertyChanged(const int &id, const QString &key, const QVariant &value);
+    void onOriginalAppletConfigPropertiesChanged(const int &id, const QVariantMap &properties);
     void onOriginalAppletInScheduledDestructionChanged(const int &id, const bool &enabled);
     void onOriginalAppletRemoved(const int &id);
     void onOriginalAppletsOrderChanged();
@@ -49,7 +49,7 @@ private slots:
     void onOriginalAppletsDisabledColoringChanged(const QList<int> &originalapplets);
 
     void updateContainmentConfigProperty(const QString &key, const QVariant &value);
-    void updateOriginalAppletConfigProperty(const int &clonedid, const QString &key, const QVariant &value);
+    void updateOriginalAppletConfigProperties(const int &clonedid, const QVariantMap &properties);
 
     void updateAppletIdsHash();
 private:
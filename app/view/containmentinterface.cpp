@@ -16,7 +16,9 @@
 // Qt
 #include <QDebug>
 #include <QDir>
+#include <QDynamicPropertyChangeEvent>
 #include <QLatin1String>
+#include <QMetaProperty>
 
 // Plasma
 #include <Plasma/Applet>
@@ -41,20 +43,25 @@ ContainmentInterface::ContainmentInterface(NSE::View *parent)
     m_latteTasksModel = new TasksModel(this);
     m_plasmaTasksModel = new TasksModel(this);
 
-    m_appletsExpandedConnectionsTimer.setInterval(2000);
-    m_appletsExpandedConnectionsTimer.setSingleShot(true);
-
-    m_appletDelayedConfigurationTimer.setInterval(1000);
-    m_appletDelayedConfigurationTimer.setSingleShot(true);
-    connect(&m_appletDelayedConfigurationTimer, &QTimer::timeout, this, &ContainmentInterface::updateAppletDelayedConfiguration);
-
-    connect(&m_appletsExpandedConnectionsTimer, &QTimer::timeout, this, &ContainmentInterface::updateAppletsTracking);
+    m_appletConfigChangesTimer.setInterval(0);
+    m_appletConfigChangesTimer.setSingleShot(true);
+    connect(&m_appletConfigChangesTimer, &QTimer::timeout, this, &ContainmentInterface::publishAppletConfigChanges);
 
     connect(m_view, &View::containmentChanged
             , this, [&]() {
         if (m_view->containment()) {
             connect(m_view->containment(), &Plasma::Containment::appletAdded, this, &ContainmentInterface::onAppletAdded);
-            m_appletsExpandedConnectionsTimer.start();
+
+            //! applets are tracked as soon as the containment has loaded their ui
+            connect(m_view->containment(), &Plasma::Containment::uiReadyChanged, this, [&](bool uiReady) {
+                if (uiReady) {
+                    updateAppletsTracking();
+                }
+            });
+
+            if (m_view->containment()->isUiReady()) {
+                updateAppletsTracking();
+            }
         }
     });
 
@@ -200,55 +207,68 @@ bool ContainmentInterface::updateBadgeForLatteTask(const QString identifier, con
         return false;
     }
 
-    const auto &applets = m_view->containment()->applets();
+    identifyLatteTasksHosts();
 
-    for (auto *applet : applets) {
-        KPluginMetaData meta = applet->kPackage().metadata();
+    bool updated{false};
 
-            if (meta.pluginId() == QLatin1String("org.kde.syndock.plasmoid")) {
+    for (const auto &host : m_latteTasksHosts) {
+        // "var" arguments are treated as QVariant in QMetaObject
+        if (host && m_updateBadgeMethod.invoke(host, Q_ARG(QVariant, identifier), Q_ARG(QVariant, value))) {
+            updated = true;
+        }
+    }
 
-            if (QQuickItem *appletInterface = applet->property("_plasma_graphicObject").value<QQuickItem *>()) {
-                const auto &childItems = appletInterface->childItems();
+    return updated;
+}
 
-                if (childItems.isEmpty()) {
-                    continue;
-                }
+void ContainmentInterface::identifyLatteTasksHosts()
+{
+    if (m_latteTasksHostsIdentified) {
+        return;
+    }
 
-                for (QQuickItem *item : childItems) {
-                    if (auto *metaObject = item->metaObject()) {
-                        // not using QMetaObject::invokeMethod to avoid warnings when calling
-                        // this on applets that don't have it or other child items since this
-                        // is pretty much trial and error.
-                        // Also, "var" arguments are treated as QVariant in QMetaObject
+    m_latteTasksHosts.clear();
+    m_updateBadgeMethod = QMetaMethod();
+
+    const auto &applets = m_view->containment()->applets();
 
-                        int methodIndex = metaObject->indexOfMethod("updateBadge(QVariant,QVariant)");
+    for (auto *applet : applets) {
+        if (applet->pluginMetaData().pluginId() != QLatin1String("org.kde.syndock.plasmoid")) {
+            continue;
+        }
 
-                        if (methodIndex == -1) {
-                            continue;
-                        }
+        if (QQuickItem *appletInterface = applet->property("_plasma_graphicObject").value<QQuickItem *>()) {
+            const auto &childItems = appletInterface->childItems();
 
-                        QMetaMethod method = metaObject->method(methodIndex);
+            for (QQuickItem *item : childItems) {
+                if (auto *metaObject = item->metaObject()) {
+                    int methodIndex{metaObject->indexOfMethod("updateBadge(QVariant,QVariant)")};
 
-                        if (method.invoke(item, Q_ARG(QVariant, identifier), Q_ARG(QVariant, value))) {
-                            return true;
-                        }
+                    if (methodIndex == -1) {
+                        continue;
                     }
+
+                    m_latteTasksHosts << item;
+                    m_updateBadgeMethod = metaObject->method(methodIndex);
+                    break;
                 }
             }
         }
     }
 
-    return false;
+    //! tasks applets whose ui is not ready yet are looked up again on next update
+    m_latteTasksHostsIdentified = !m_latteTasksHosts.isEmpty();
 }
 
-bool ContainmentInterface::activatePlasmaTask(const int index)
+void ContainmentInterface::identifyPlasmaTasksHost()
 {
-    bool containsPlasmaTaskManager{hasPlasmaTasks() && !hasLatteTasks()};
-
-    if (!containsPlasmaTaskManager) {
-        return false;
+    if (m_plasmaTasksHost) {
+        return;
     }
 
+    m_activatePlasmaTaskMethod = QMetaMethod();
+    m_newInstanceForPlasmaTaskMethod = QMetaMethod();
+
     const auto &applets = m_view->containment()->applets();
 
     for (auto *applet : applets) {
@@ -258,37 +278,26 @@ bool ContainmentInterface::activatePlasmaTask(const int index)
             if (QQuickItem *appletInterface = applet->property("_plasma_graphicObject").value<QQuickItem *>()) {
                 const auto &childItems = appletInterface->childItems();
 
-                if (childItems.isEmpty()) {
-                    continue;
-                }
-
-                KPluginMetaData meta = applet->kPackage().metadata();
-
                 for (QQuickItem *item : childItems) {
                     if (auto *metaObject = item->metaObject()) {
-                        int methodIndex{metaObject->indexOfMethod("activateTaskAtIndex(QVariant)")};
+                        int activateIndex{metaObject->indexOfMethod("activateTaskAtIndex(QVariant)")};
 
-                        if (methodIndex == -1) {
+                        if (activateIndex == -1) {
                             continue;
                         }
 
-                        QMetaMethod method = metaObject->method(methodIndex);
-
-                        if (method.invoke(item, Q_ARG(QVariant, index - 1))) {
-                            showShortcutBadges(false, true);
-
-                            return true;
-                        }
+                        m_plasmaTasksHost = item;
+                        m_activatePlasmaTaskMethod = metaObject->method(activateIndex);
+                        m_newInstanceForPlasmaTaskMethod = metaObject->method(metaObject->indexOfMethod("newInstanceForTaskAtIndex(QVariant)"));
+                        return;
                     }
                 }
             }
         }
     }
-
-    return false;
 }
 
-bool ContainmentInterface::newInstanceForPlasmaTask(const int index)
+bool ContainmentInterface::activatePlasmaTask(const int index)
 {
     bool containsPlasmaTaskManager{hasPlasmaTasks() && !hasLatteTasks()};
 
@@ -296,40 +305,37 @@ bool ContainmentInterface::newInstanceForPlasmaTask(const int index)
         return false;
     }
 
-    const auto &applets = m_view->containment()->applets();
-
-    for (auto *applet : applets) {
-        const auto &provides = KPluginMetaData::readStringList(applet->pluginMetaData().rawData(), QStringLiteral("X-Plasma-Provides"));
+    identifyPlasmaTasksHost();
 
-        if (provides.contains(QLatin1String("org.kde.plasma.multitasking"))) {
-            if (QQuickItem *appletInterface = applet->property("_plasma_graphicObject").value<QQuickItem *>()) {
-                const auto &childItems = appletInterface->childItems();
+    if (!m_plasmaTasksHost || !m_activatePlasmaTaskMethod.isValid()) {
+        return false;
+    }
 
-                if (childItems.isEmpty()) {
-                    continue;
-                }
+    if (m_activatePlasmaTaskMethod.invoke(m_plasmaTasksHost, Q_ARG(QVariant, index - 1))) {
+        showShortcutBadges(false, true);
+        return true;
+    }
 
-                KPluginMetaData meta = applet->kPackage().metadata();
+    return false;
+}
 
-                for (QQuickItem *item : childItems) {
-                    if (auto *metaObject = item->metaObject()) {
-                        int methodIndex{metaObject->indexOfMethod("newInstanceForTaskAtIndex(QVariant)")};
+bool ContainmentInterface::newInstanceForPlasmaTask(const int index)
+{
+    bool containsPlasmaTaskManager{hasPlasmaTasks() && !hasLatteTasks()};
 
-                        if (methodIndex == -1) {
-                            continue;
-                        }
+    if (!containsPlasmaTaskManager) {
+        return false;
+    }
 
-                        QMetaMethod method = metaObject->method(methodIndex);
+    identifyPlasmaTasksHost();
 
-                        if (method.invoke(item, Q_ARG(QVariant, index - 1))) {
-                            showShortcutBadges(false, true);
+    if (!m_plasmaTasksHost || !m_newInstanceForPlasmaTaskMethod.isValid()) {
+        return false;
+    }
 
-                            return true;
-                        }
-                    }
-                }
-            }
-        }
+    if (m_newInstanceForPlasmaTaskMethod.invoke(m_plasmaTasksHost, Q_ARG(QVariant, index - 1))) {
+        showShortcutBadges(false, true);
+        return true;
     }
 
     return false;
@@ -767,6 +773,9 @@ void ContainmentInterface::updateAppletsDisabledColoring()
 
 void ContainmentInterface::onLatteTasksCountChanged()
 {
+    //! a latte tasks applet was added or removed
+    m_latteTasksHostsIdentified = false;
+
     if ((m_hasLatteTasks && m_latteTasksModel->count()>0)
             || (!m_hasLatteTasks && m_latteTasksModel->count() == 0)) {
         return;
@@ -778,6 +787,9 @@ void ContainmentInterface::onLatteTasksCountChanged()
 
 void ContainmentInterface::onPlasmaTasksCountChanged()
 {
+    //! a plasma task manager was added or removed
+    m_plasmaTasksHost = nullptr;
+
     if ((m_hasPlasmaTasks && m_plasmaTasksModel->count()>0)
             || (!m_hasPlasmaTasks && m_plasmaTasksModel->count() == 0)) {
         return;
@@ -868,16 +880,19 @@ void ContainmentInterface::updateContainmentConfigProperty(const QString &key, c
     }
 }
 
-void ContainmentInterface::updateAppletConfigProperty(const int &id, const QString &key, const QVariant &value)
+void ContainmentInterface::updateAppletConfigProperties(const int &id, const QVariantMap &properties)
 {
-    if (!m_appletData.contains(id) || !m_appletData[id].configuration || !m_appletData[id].configuration->keys().contains(key)) {
+    if (!m_appletData.contains(id) || !m_appletData[id].configuration) {
         return;
     }
 
-    if (m_appletData[id].configuration->keys().contains(key)
-            && (*m_appletData[id].configuration)[key] != value) {
-        m_appletData[id].configuration->insert(key, value);
-        emit m_appletData[id].configuration->valueChanged(key, value);
+    KDeclarative::ConfigPropertyMap *configuration = m_appletData[id].configuration;
+
+    for (auto it = properties.cbegin(); it != properties.cend(); ++it) {
+        if (configuration->contains(it.key()) && (*configuration)[it.key()] != it.value()) {
+            configuration->insert(it.key(), it.value());
+            emit configuration->valueChanged(it.key(), it.value());
+        }
     }
 }
 
@@ -894,33 +909,96 @@ void ContainmentInterface::updateAppletsTracking()
     emit initializationCompleted();
 }
 
-void ContainmentInterface::updateAppletDelayedConfiguration()
+void ContainmentInterface::updatePendingAppletConfigurations()
 {
-    for (const auto id : m_appletData.keys()) {
-        if (!m_appletData[id].configuration) {
-            m_appletData[id].configuration = appletConfiguration(m_appletData[id].applet);
+    for (auto it = m_appletData.begin(); it != m_appletData.end(); ++it) {
+        if (!it->configuration) {
+            it->configuration = appletConfiguration(it->applet);
 
-            if (m_appletData[id].configuration) {
-                qDebug() << "org.kde.sync delayed applet configuration was successful for : " << id;
-                initAppletConfigurationSignals(id, m_appletData[id].configuration);
+            if (it->configuration) {
+                qDebug() << "org.kde.sync delayed applet configuration was successful for : " << it->id;
+                initAppletConfigurationSignals(it->id, it->configuration);
             }
         }
     }
 }
 
+void ContainmentInterface::publishAppletConfigChanges()
+{
+    const auto changes = m_pendingAppletConfigChanges;
+    m_pendingAppletConfigChanges.clear();
+
+    for (auto it = changes.cbegin(); it != changes.cend(); ++it) {
+        emit appletConfigPropertiesChanged(it.key(), it.value());
+    }
+}
+
 void ContainmentInterface::initAppletConfigurationSignals(const int &id, KDeclarative::ConfigPropertyMap *configuration)
 {
     if (!configuration) {
         return;
     }
 
-    connect(configuration, &QQmlPropertyMap::valueChanged,
-            this, [&, id](const QString &key, const QVariant &value) {
-        //qDebug() << "org.kde.sync applet property changed : " << currentAppletId << " __ " << m_appletData[currentAppletId].plugin << " __ " << key << " __ " << value;
-        emit appletConfigPropertyChanged(id, key, value);
+    //! applets can be tracked again e.g. when the containment ui is reloaded
+    disconnect(m_appletConfigurationConnections.value(id));
+
+    m_appletConfigurationConnections[id] = connect(configuration, &QQmlPropertyMap::valueChanged,
+                                                   this, [&, id](const QString &key, const QVariant &value) {
+        //qDebug() << "org.kde.sync applet property changed : " << id << " __ " << key << " __ " << value;
+        m_pendingAppletConfigChanges[id][key] = value;
+
+        if (!m_appletConfigChangesTimer.isActive()) {
+            m_appletConfigChangesTimer.start();
+        }
     });
 }
 
+void ContainmentInterface::watchAppletConfiguration(Plasma::Applet *applet, PlasmaQuick::AppletQuickItem *appletQuickItem)
+{
+    QObject *configurationHost = appletQuickItem;
+
+    if (Layouts::Storage::self()->isSubContainment(m_view->corona(), applet)) {
+        Plasma::Containment *subcontainment = Layouts::Storage::self()->subContainmentOf(m_view->corona(), applet);
+
+        if (subcontainment) {
+            connect(subcontainment, &Plasma::Containment::uiReadyChanged, this, &ContainmentInterface::updatePendingAppletConfigurations, Qt::UniqueConnection);
+            configurationHost = subcontainment->property("_plasma_graphicObject").value<PlasmaQuick::AppletQuickItem *>();
+        }
+    }
+
+    if (!configurationHost) {
+        return;
+    }
+
+    //! the configuration object is exposed together with the applet ui
+    int metaconfigindex = configurationHost->metaObject()->indexOfProperty("configuration");
+
+    if (metaconfigindex >= 0) {
+        QMetaProperty configurationProperty = configurationHost->metaObject()->property(metaconfigindex);
+
+        if (configurationProperty.hasNotifySignal()) {
+            static const QMetaMethod updateMethod = staticMetaObject.method(staticMetaObject.indexOfSlot("updatePendingAppletConfigurations()"));
+            connect(configurationHost, configurationProperty.notifySignal(), this, updateMethod, Qt::UniqueConnection);
+        }
+    }
+}
+
+bool ContainmentInterface::eventFilter(QObject *watched, QEvent *event)
+{
+    if (event->type() == QEvent::DynamicPropertyChange
+            && static_cast<QDynamicPropertyChangeEvent *>(event)->propertyName() == "_plasma_graphicObject") {
+        Plasma::Applet *applet = qobject_cast<Plasma::Applet *>(watched);
+
+        if (applet && m_appletsWaitingUi.contains(applet)) {
+            applet->removeEventFilter(this);
+            m_appletsWaitingUi.removeAll(applet);
+            onAppletAdded(applet);
+        }
+    }
+
+    return QObject::eventFilter(watched, event);
+}
+
 KDeclarative::ConfigPropertyMap *ContainmentInterface::appletConfiguration(const Plasma::Applet *applet)
 {
     if (!m_view->containment() || !applet) {
@@ -1012,6 +1090,12 @@ void ContainmentInterface::onAppletAdded(Plasma::Applet *applet)
         }
     }
 
+    //! applet ui is created afterwards, track the applet when it is exposed
+    if (!ai && !m_appletsWaitingUi.contains(applet)) {
+        m_appletsWaitingUi << applet;
+        applet->installEventFilter(this);
+    }
+
     //! Track All Applets, for example to support syncing between different docks and panels
     if (ai) {
         bool initializing{!m_appletData.contains(currentAppletId)};
@@ -1030,8 +1114,8 @@ void ContainmentInterface::onAppletAdded(Plasma::Applet *applet)
         if (data.configuration) {
             initAppletConfigurationSignals(data.id, data.configuration);
         } else {
-            qDebug() << "org.kde.sync Unfortunately configuration syncing for :: " << currentAppletId << " was not established, configuration object was missing!";
-            m_appletDelayedConfigurationTimer.start();
+            qDebug() << "org.kde.sync configuration syncing for :: " << currentAppletId << " is postponed until its configuration object is created";
+            watchAppletConfiguration(applet, ai);
         }
 
         if (initializing) {
@@ -1045,6 +1129,8 @@ void ContainmentInterface::onAppletAdded(Plasma::Applet *applet)
                 emit appletRemoved(data.id);
                 //qDebug() << "org.kde.sync: removing applet ::: " << data.id << " __ " << data.plugin << " remained : " << m_appletData.keys();
                 m_appletData.remove(data.id);
+                m_appletConfigurationConnections.remove(data.id);
+                m_pendingAppletConfigChanges.remove(data.id);
             });
         }
 
@@ -17,6 +17,7 @@
 #include <QQuickItem>
 #include <QTimer>
 #include <QUrl>
+#include <QVariantMap>
 
 namespace Plasma {
 class Applet;
@@ -124,7 +125,7 @@ public slots:
     void setAppletsDisabledColoring(const QList<int> &applets);
     void setAppletInScheduledDestruction(const int &id, const bool &enabled);
     void updateContainmentConfigProperty(const QString &key, const QVariant &value);
-    void updateAppletConfigProperty(const int &id, const QString &key, const QVariant &value);    
+    void updateAppletConfigProperties(const int &id, const QVariantMap &properties);
 
 signals:
     void expandedAppletStateChanged();
@@ -140,7 +141,8 @@ signals:
     //! syncing signals
     void appletRemoved(const int &id);
 
-    void appletConfigPropertyChanged(const int &id, const QString &key, const QVariant &value);
+    //! all configuration changes of an applet during one event loop turn
+    void appletConfigPropertiesChanged(const int &id, const QVariantMap &properties);
     void appletCreated(const QString &pluginId);
     void appletDataCreated(const int &id);
     void appletDropped(QObject *data, int x, int y);
@@ -152,15 +154,21 @@ signals:
 
     void appletRequestedVisualIndicator(const int &plasmoidId);
 
+protected:
+    bool eventFilter(QObject *watched, QEvent *event) override;
+
 private slots:
     void identifyShortcutsHost();
     void identifyMethods();
+    void identifyPlasmaTasksHost();
+    void identifyLatteTasksHosts();
 
     void updateAppletsOrder();
     void updateAppletsInLockedZoom();
     void updateAppletsDisabledColoring();
     void updateAppletsTracking();
-    void updateAppletDelayedConfiguration();
+    void updatePendingAppletConfigurations();
+    void publishAppletConfigChanges();
 
     void onAppletAdded(Plasma::Applet *applet);
     void onAppletExpandedChanged();
@@ -171,6 +179,7 @@ private:
     void addExpandedApplet(PlasmaQuick::AppletQuickItem * appletQuickItem);
     void removeExpandedApplet(PlasmaQuick::AppletQuickItem *appletQuickItem);
     void initAppletConfigurationSignals(const int &id, KDeclarative::ConfigPropertyMap *configuration);
+    void watchAppletConfiguration(Plasma::Applet *applet, PlasmaQuick::AppletQuickItem *appletQuickItem);
 
     bool appletIsExpandable(PlasmaQuick::AppletQuickItem *appletQuickItem) const;
 
@@ -181,19 +190,25 @@ private:
 private:
     bool m_hasLatteTasks{false};
     bool m_hasPlasmaTasks{false};
+    bool m_latteTasksHostsIdentified{false};
 
     QMetaMethod m_activateEntryMethod;
     QMetaMethod m_appletIdForIndexMethod;
     QMetaMethod m_newInstanceMethod;
     QMetaMethod m_showShortcutsMethod;
 
+    //! plasma task manager item that serves the shortcuts, reset when tasks applets change
+    QMetaMethod m_activatePlasmaTaskMethod;
+    QMetaMethod m_newInstanceForPlasmaTaskMethod;
+
+    //! latte tasks items that own the badges, reset when tasks applets change
+    QMetaMethod m_updateBadgeMethod;
+
     QPointer<NSE::Corona> m_corona;
     QPointer<NSE::View> m_view;
     QPointer<QQuickItem> m_shortcutsHost;
-
-    //! startup timer to initialize
-    //! applets tracking
-    QTimer m_appletsExpandedConnectionsTimer;
+    QPointer<QQuickItem> m_plasmaTasksHost;
+    QList<QPointer<QQuickItem>> m_latteTasksHosts;
 
     TasksModel *m_latteTasksModel;
     TasksModel *m_plasmaTasksModel;
@@ -212,7 +227,14 @@ private:
     QList<int> m_appletsInLockedZoom;
     QList<int> m_appletsDisabledColoring;
     QHash<int, ViewPart::AppletInterfaceData> m_appletData;
-    QTimer m_appletDelayedConfigurationTimer;
+    QHash<int, QMetaObject::Connection> m_appletConfigurationConnections;
+
+    //! applets whose ui has not been created yet
+    QList<QPointer<Plasma::Applet>> m_appletsWaitingUi;
+
+    //! configuration changes are published to clones once per event loop turn
+    QHash<int, QVariantMap> m_pendingAppletConfigChanges;
+    QTimer m_appletConfigChangesTimer;
 };
 
 }
@@ -9,15 +9,17 @@
 #include <config-syndock.h>
 #include <coretypes.h>
 #include "panelshadows_p.h"
+#include "surfacetransaction.h"
 #include "view.h"
 #include "../nsecoronainterface.h"
 #include "../wm/abstractwindowinterface.h"
 
 // Qt
+#include <QEvent>
+#include <QMetaProperty>
 #include <QRegion>
 
 // KDE
-#include <KWindowEffects>
 #include <KWindowSystem>
 
 
@@ -26,7 +28,9 @@ namespace ViewPart {
 
 Effects::Effects(NSE::View *parent)
     : QObject(parent),
-      m_view(parent)
+      m_view(parent),
+      m_surface(new SurfaceTransaction(parent)),
+      m_geometry(new SurfaceGeometry(parent))
 {
     m_corona = qobject_cast<NSE::Corona *>(m_view->corona());
 
@@ -39,12 +43,15 @@ Effects::~Effects()
 
 void Effects::init()
 {
+    connect(m_surface, &SurfaceTransaction::aboutToCommit, this, &Effects::applyEffects);
+
     connect(this, &Effects::backgroundOpacityChanged, this, &Effects::updateEffects);
     connect(this, &Effects::backgroundOpacityChanged, this, &Effects::updateBackgroundContrastValues);
-    connect(this, &Effects::backgroundCornersMaskChanged, this, &Effects::updateEffects);
-    connect(this, &Effects::backgroundRadiusEnabledChanged, this, &Effects::updateEffects);
+    connect(this, &Effects::backgroundCornersMaskChanged, this, &Effects::invalidateEffectsRegion);
+    connect(this, &Effects::backgroundRadiusEnabledChanged, this, &Effects::invalidateEffectsRegion);
     connect(this, &Effects::drawEffectsChanged, this, &Effects::updateEffects);
-    connect(this, &Effects::enabledBordersChanged, this, &Effects::updateEffects);
+    connect(this, &Effects::enabledBordersChanged, this, &Effects::invalidateEffectsRegion);
+    connect(this, &Effects::panelBackgroundSvgChanged, this, &Effects::invalidateEffectsRegion);
     connect(this, &Effects::rectChanged, this, &Effects::updateEffects);
 
 
@@ -70,6 +77,9 @@ void Effects::init()
     });
 
     connect(this, &Effects::backgroundRadiusChanged, this, &Effects::updateBackgroundCorners);
+    //! corner masks are sampled at device pixels, see also eventFilter for scale changes
+    connect(m_view, &QWindow::screenChanged, this, &Effects::updateBackgroundCorners);
+    m_view->installEventFilter(this);
 
     connect(this, &Effects::drawShadowsChanged, this, [&]() {
         if (m_view->behaveAsPlasmaPanel()) {
@@ -85,7 +95,9 @@ void Effects::init()
     connect(m_view, &NSE::View::maxLengthChanged, this, &Effects::updateEnabledBorders);
     connect(m_view, &NSE::View::offsetChanged, this, &Effects::updateEnabledBorders);
     connect(m_view, &NSE::View::screenEdgeMarginEnabledChanged, this, &Effects::updateEnabledBorders);
-    connect(m_view, &NSE::View::behaveAsPlasmaPanelChanged, this, &Effects::updateEffects);
+    connect(m_view, &NSE::View::behaveAsPlasmaPanelChanged, this, &Effects::invalidateEffectsRegion);
+    connect(m_view, &NSE::View::headThicknessGapChanged, this, &Effects::invalidateEffectsRegion);
+    connect(m_view, &NSE::View::locationChanged, this, &Effects::invalidateEffectsRegion);
     connect(this, &Effects::drawShadowsChanged, this, &Effects::updateShadows);
     connect(m_view, &NSE::View::behaveAsPlasmaPanelChanged, this, &Effects::updateShadows);
     connect(m_view, &NSE::View::configWindowGeometryChanged, this, &Effects::updateMask);
@@ -93,7 +105,7 @@ void Effects::init()
 
     connect(&m_theme, &Plasma::Theme::themeChanged, this, [&]() {
         updateBackgroundContrastValues();
-        updateEffects();
+        invalidateEffectsRegion();
     });
 }
 
@@ -320,7 +332,7 @@ void Effects::setInputMask(QRect area)
         m_corona->wm()->setInputMask(m_view, area);
     } else {
         //under wayland mask() is providing the Input Area
-        m_view->setMask(area);
+        m_surface->setMask(area);
     }
 
     emit inputMaskChanged();
@@ -354,10 +366,36 @@ void Effects::setPanelBackgroundSvg(QQuickItem *quickitem)
         return;
     }
 
+    for (const auto &connection : m_panelBackgroundSvgConnections) {
+        disconnect(connection);
+    }
+
+    m_panelBackgroundSvgConnections.clear();
+
     m_panelBackgroundSvg = quickitem;
+
+    if (m_panelBackgroundSvg) {
+        //! the mask is read by name, FrameSvgItem is not exposed to the application
+        const QMetaObject *svgMetaObject = m_panelBackgroundSvg->metaObject();
+        const QMetaProperty maskProperty = svgMetaObject->property(svgMetaObject->indexOfProperty("mask"));
+        const int invalidateIndex = metaObject()->indexOfSlot("invalidateEffectsRegion()");
+
+        if (maskProperty.hasNotifySignal() && invalidateIndex >= 0) {
+            m_panelBackgroundSvgConnections << connect(m_panelBackgroundSvg, maskProperty.notifySignal(), this, metaObject()->method(invalidateIndex));
+        }
+
+        m_panelBackgroundSvgConnections << connect(m_panelBackgroundSvg, &QQuickItem::widthChanged, this, &Effects::invalidateEffectsRegion);
+        m_panelBackgroundSvgConnections << connect(m_panelBackgroundSvg, &QQuickItem::heightChanged, this, &Effects::invalidateEffectsRegion);
+    }
+
     emit panelBackgroundSvgChanged();
 }
 
+SurfaceGeometry *Effects::geometry() const
+{
+    return m_geometry;
+}
+
 void Effects::onPopUpMarginChanged()
 {
     m_view->setProperty("_applets_popup_margin", QVariant(popUpMargin()));
@@ -410,35 +448,7 @@ void Effects::removeUnitedMaskRegion(const QString &regionid)
 
 QRegion Effects::customMask(const QRect &rect)
 {
-    QRegion result = rect;
-    int dx = rect.right() - m_cornersMaskRegion.topLeft.boundingRect().width() + 1;
-    int dy = rect.bottom() - m_cornersMaskRegion.topLeft.boundingRect().height() + 1;
-
-    if (m_hasTopLeftCorner) {
-        QRegion tl = m_cornersMaskRegion.topLeft;
-        tl.translate(rect.x(), rect.y());
-        result = result.subtracted(tl);
-    }
-
-    if (m_hasTopRightCorner) {
-        QRegion tr = m_cornersMaskRegion.topRight;
-        tr.translate(rect.x() + dx, rect.y());
-        result = result.subtracted(tr);
-    }
-
-    if (m_hasBottomRightCorner) {
-        QRegion br = m_cornersMaskRegion.bottomRight;
-        br.translate(rect.x() + dx, rect.y() + dy);
-        result = result.subtracted(br);
-    }
-
-    if (m_hasBottomLeftCorner) {
-        QRegion bl = m_cornersMaskRegion.bottomLeft;
-        bl.translate(rect.x(), rect.y() + dy);
-        result = result.subtracted(bl);
-    }
-
-    return result;
+    return m_cornersMask.roundedRegion(rect, m_hasTopLeftCorner, m_hasTopRightCorner, m_hasBottomLeftCorner, m_hasBottomRightCorner);
 }
 
 QRegion Effects::maskCombinedRegion()
@@ -456,15 +466,29 @@ QRegion Effects::maskCombinedRegion()
     return region;
 }
 
+bool Effects::eventFilter(QObject *watched, QEvent *event)
+{
+    if (watched == m_view && event->type() == QEvent::DevicePixelRatioChange) {
+        updateBackgroundCorners();
+    }
+
+    return QObject::eventFilter(watched, event);
+}
+
 void Effects::updateBackgroundCorners()
 {
     if (m_backgroundRadius<0) {
         return;
     }
 
-    m_corona->themeExtended()->cornersMask(m_backgroundRadius);
+    const qreal dpr = m_view->devicePixelRatio();
+
+    if (m_cornersMask.radius() == m_backgroundRadius && qFuzzyCompare(m_cornersMaskDevicePixelRatio, dpr)) {
+        return;
+    }
 
-    m_cornersMaskRegion = m_corona->themeExtended()->cornersMask(m_backgroundRadius);
+    m_cornersMask = PlasmaExtended::CornerMask::forRadius(m_backgroundRadius, dpr);
+    m_cornersMaskDevicePixelRatio = dpr;
     emit backgroundCornersMaskChanged();
 }
 
@@ -513,7 +537,7 @@ void Effects::updateMask()
             fixedMask = QRegion(maskRect);
         }
 
-        m_view->setMask(fixedMask);
+        m_surface->setMask(fixedMask);
     }
 }
 
@@ -522,6 +546,12 @@ void Effects::clearShadows()
     PanelShadows::self()->removeWindow(m_view);
 }
 
+void Effects::invalidateSurface()
+{
+    m_surface->invalidate();
+    m_surface->scheduleCommit();
+}
+
 void Effects::updateShadows()
 {
     if (m_view->behaveAsPlasmaPanel() && drawShadows()) {
@@ -533,94 +563,114 @@ void Effects::updateShadows()
 
 void Effects::updateEffects()
 {
-    //! Don't apply any effect before the wayland surface is created under wayland
-    //! https://bugs.kde.org/show_bug.cgi?id=392890
-    if (KWindowSystem::isPlatformWayland() && !m_view->surface()) {
+    //! effect regions are evaluated only once per frame, when the surface state is published
+    m_effectsDirty = true;
+    m_surface->scheduleCommit();
+}
+
+void Effects::invalidateEffectsRegion()
+{
+    m_hasShownEffectsRegion = false;
+    updateEffects();
+}
+
+QRegion Effects::effectsRegion()
+{
+    QRegion backMask;
+
+    if (m_backgroundRadiusEnabled) {
+        //! CustomBackground way
+        backMask = customMask(QRect(0,0,m_rect.width(), m_rect.height()));
+    } else {
+        //! Plasma::Theme way
+        //! this is used when compositing is disabled and provides
+        //! the correct way for the mask to be painted in order for
+        //! rounded corners to be shown correctly
+        const QVariant maskProperty = m_panelBackgroundSvg->property("mask");
+        if (static_cast<QMetaType::Type>(maskProperty.type()) == QMetaType::QRegion) {
+            backMask = maskProperty.value<QRegion>();
+        }
+    }
+
+    //! adjust mask coordinates based on local coordinates
+    int fX = m_rect.x(); int fY = m_rect.y();
+
+    //! Latte is now using GtkFrameExtents so Effects geometries must be adjusted
+    //! windows that use GtkFrameExtents and apply Effects on them they take GtkFrameExtents
+    //! as granted
+    if (KWindowSystem::isPlatformX11() && !m_view->byPassWM()) {
+        if (m_view->location() == Plasma::Types::BottomEdge) {
+            fY = qMax(0, fY - m_view->headThicknessGap());
+        } else if (m_view->location() == Plasma::Types::RightEdge) {
+            fX = qMax(0, fX - m_view->headThicknessGap());
+        }
+    }
+
+    //! There are cases that mask is NULL even though it should not
+    //! Example: SidebarOnDemand from v0.10 that BEHAVEASPLASMAPANEL in EditMode
+    //! switching multiple times between inConfigureAppletsMode and LiveEditMode
+    //! is such a case
+    QRegion fixedMask;
+
+    if (!backMask.isNull()) {
+        fixedMask = backMask;
+        fixedMask.translate(fX, fY);
+    } else {
+        fixedMask = QRect(fX, fY, m_rect.width(), m_rect.height());
+    }
+
+    return fixedMask;
+}
+
+void Effects::applyEffects()
+{
+    if (!m_effectsDirty) {
         return;
     }
 
+    m_effectsDirty = false;
+
     bool clearEffects{true};
 
     if (m_drawEffects) {
         if (!m_view->behaveAsPlasmaPanel()) {
+            //! hidden views switch to the canonical cleared state and keep the shown region,
+            //! showing them again restores it without recomputing masks
             if (!m_rect.isNull() && !m_rect.isEmpty() && m_rect != VisibilityManager::ISHIDDENMASK) {
-                QRegion backMask;
-
-                if (m_backgroundRadiusEnabled) {
-                    //! CustomBackground way
-                    backMask = customMask(QRect(0,0,m_rect.width(), m_rect.height()));
-                } else {
-                    //! Plasma::Theme way
-                    //! this is used when compositing is disabled and provides
-                    //! the correct way for the mask to be painted in order for
-                    //! rounded corners to be shown correctly
-                    if (!m_panelBackgroundSvg) {
+                if (!m_hasShownEffectsRegion || m_shownEffectsRect != m_rect) {
+                    if (!m_backgroundRadiusEnabled && !m_panelBackgroundSvg) {
                         return;
                     }
 
-                    if (m_rect == VisibilityManager::ISHIDDENMASK) {
-                        clearEffects = true;
-                    } else {
-                        const QVariant maskProperty = m_panelBackgroundSvg->property("mask");
-                        if (static_cast<QMetaType::Type>(maskProperty.type()) == QMetaType::QRegion) {
-                            backMask = maskProperty.value<QRegion>();
-                        }
-                    }
-                }
-
-                //! adjust mask coordinates based on local coordinates
-                int fX = m_rect.x(); int fY = m_rect.y();
-
-                //! Latte is now using GtkFrameExtents so Effects geometries must be adjusted
-                //! windows that use GtkFrameExtents and apply Effects on them they take GtkFrameExtents
-                //! as granted
-                if (KWindowSystem::isPlatformX11() && !m_view->byPassWM()) {
-                    if (m_view->location() == Plasma::Types::BottomEdge) {
-                        fY = qMax(0, fY - m_view->headThicknessGap());
-                    } else if (m_view->location() == Plasma::Types::RightEdge) {
-                        fX = qMax(0, fX - m_view->headThicknessGap());
-                    }
-                }
-
-                //! There are cases that mask is NULL even though it should not
-                //! Example: SidebarOnDemand from v0.10 that BEHAVEASPLASMAPANEL in EditMode
-                //! switching multiple times between inConfigureAppletsMode and LiveEditMode
-                //! is such a case
-                QRegion fixedMask;
-
-                if (!backMask.isNull()) {
-                    fixedMask = backMask;
-                    fixedMask.translate(fX, fY);
-                } else {
-                    fixedMask = QRect(fX, fY, m_rect.width(), m_rect.height());
+                    m_shownEffectsRegion = effectsRegion();
+                    m_shownEffectsRect = m_rect;
+                    m_hasShownEffectsRegion = true;
                 }
 
-                if (!fixedMask.isEmpty()) {
+                if (!m_shownEffectsRegion.isEmpty()) {
                     clearEffects = false;
-                    KWindowEffects::enableBlurBehind(m_view->winId(), true, fixedMask);
-                    KWindowEffects::enableBackgroundContrast(m_view->winId(),
-                                                             m_theme.backgroundContrastEnabled(),
-                                                             m_backEffectContrast,
-                                                             m_backEffectIntesity,
-                                                             m_backEffectSaturation,
-                                                             fixedMask);
+                    m_surface->setBlurBehind(true, m_shownEffectsRegion);
+                    m_surface->setBackgroundContrast(m_theme.backgroundContrastEnabled(),
+                                                     m_backEffectContrast,
+                                                     m_backEffectIntesity,
+                                                     m_backEffectSaturation,
+                                                     m_shownEffectsRegion);
                 }
             }
         } else {
             //!  BEHAVEASPLASMAPANEL case
             clearEffects = false;
-            KWindowEffects::enableBlurBehind(m_view->winId(), true);
-            KWindowEffects::enableBackgroundContrast(m_view->winId(),
-                                                     m_theme.backgroundContrastEnabled(),
-                                                     m_backEffectContrast,
-                                                     m_backEffectIntesity,
-                                                     m_backEffectSaturation);
+            m_surface->setBlurBehind(true);
+            m_surface->setBackgroundContrast(m_theme.backgroundContrastEnabled(),
+                                             m_backEffectContrast,
+                                             m_backEffectIntesity,
+                                             m_backEffectSaturation);
         }
     }
 
     if (clearEffects) {
-        KWindowEffects::enableBlurBehind(m_view->winId(), false);
-        KWindowEffects::enableBackgroundContrast(m_view->winId(), false);
+        m_surface->setBlurBehind(false);
+        m_surface->setBackgroundContrast(false);
     }
 }
 
@@ -7,6 +7,8 @@
 #define EFFECTS_H
 
 // local
+#include "surfacegeometry.h"
+#include "../plasma/extended/cornermask.h"
 #include "../plasma/extended/theme.h"
 
 // Qt
@@ -24,6 +26,12 @@ class Corona;
 class View;
 }
 
+namespace NSE {
+namespace ViewPart {
+class SurfaceTransaction;
+}
+}
+
 namespace NSE {
 namespace ViewPart {
 
@@ -54,6 +62,9 @@ class Effects: public QObject
 
     Q_PROPERTY(QQuickItem *panelBackgroundSvg READ panelBackgroundSvg WRITE setPanelBackgroundSvg NOTIFY panelBackgroundSvgChanged)
 
+    //! derives rect, inputMask and view localGeometry from the metrics qml publishes
+    Q_PROPERTY(NSE::ViewPart::SurfaceGeometry *geometry READ geometry CONSTANT)
+
 public:
     Effects(NSE::View *parent);
     virtual ~Effects();
@@ -107,6 +118,8 @@ public:
     QQuickItem *panelBackgroundSvg() const;
     void setPanelBackgroundSvg(QQuickItem *quickitem);
 
+    SurfaceGeometry *geometry() const;
+
 public slots:
     Q_INVOKABLE void forceMaskRedraw();
     Q_INVOKABLE void setSubtractedMaskRegion(const QString &regionid, const QRegion &region);
@@ -116,6 +129,8 @@ public slots:
 
     void clearShadows();
     void updateShadows();
+    //! publish again the whole surface state, e.g. when the platform surface was recreated
+    void invalidateSurface();
     void updateEffects();
     void updateEnabledBorders();
     void updateMask();
@@ -142,9 +157,15 @@ signals:
     void subtractedMaskRegionsChanged();
     void unitedMaskRegionsChanged();
 
+protected:
+    bool eventFilter(QObject *watched, QEvent *event) override;
+
 private slots:
     void init();
 
+    void applyEffects();
+    void invalidateEffectsRegion();
+
     void onPopUpMarginChanged();
 
     void updateBackgroundContrastValues();
@@ -154,6 +175,7 @@ private:
     bool backgroundRadiusIsEnabled() const;
     qreal currentMidValue(const qreal &max, const qreal &factor, const qreal &min) const;
     QRegion customMask(const QRect &rect);
+    QRegion effectsRegion();
     QRegion maskCombinedRegion();
 
 private:
@@ -164,6 +186,7 @@ private:
     bool m_drawEffects{false};
     bool m_forceTopBorder{false};
     bool m_forceBottomBorder{false};
+    bool m_effectsDirty{false};
 
     bool m_hasTopLeftCorner{false};
     bool m_hasTopRightCorner{false};
@@ -185,10 +208,19 @@ private:
     QRect m_inputMask;
     QRect m_appletsLayoutGeometry;
 
+    //! effects region of the last shown state, kept while the view is hidden
+    bool m_hasShownEffectsRegion{false};
+    QRect m_shownEffectsRect;
+    QRegion m_shownEffectsRegion;
+
     QPointer<NSE::View> m_view;
     QPointer<NSE::Corona> m_corona;
+    QPointer<SurfaceTransaction> m_surface;
+    QPointer<SurfaceGeometry> m_geometry;
 
-    PlasmaExtended::CornerRegions m_cornersMaskRegion;
+    PlasmaExtended::CornerMask m_cornersMask;
+    //! device pixel ratio that m_cornersMask was sampled at
+    qreal m_cornersMaskDevicePixelRatio{0};
 
     Plasma::Theme m_theme;
 
@@ -197,6 +229,8 @@ private:
 
     //assigned from qml side in order to access the official panel background svg
     QQuickItem *m_panelBackgroundSvg{nullptr};
+    //! its mask and size changes invalidate the cached effects region
+    QList<QMetaObject::Connection> m_panelBackgroundSvgConnections;
 
     //! Subtracted and United Mask regions
     QHash<QString, QRegion> m_subtractedMaskRegions;
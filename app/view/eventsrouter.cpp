@@ -0,0 +1,150 @@
+/* This file is a part of the Atmo desktop experience's SynDock project for SynOS.
+ * Copyright (C) 2026 Syndromatic Ltd. All rights reserved
+ * Designed by Kavish Krishnakumar in Manchester.
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "eventsrouter.h"
+
+// local
+#include "view.h"
+
+// Qt
+#include <QDropEvent>
+#include <QPointF>
+#include <QSinglePointEvent>
+
+namespace NSE {
+namespace ViewPart {
+
+EventsRouter::EventsRouter(NSE::View *parent)
+    : QObject(parent),
+      m_view(parent)
+{
+}
+
+EventsRouter::~EventsRouter()
+{
+}
+
+int EventsRouter::subscribe(QObject *receiver, std::initializer_list<QEvent::Type> types, Handler handler)
+{
+    if (!receiver || !handler) {
+        return 0;
+    }
+
+    Subscription subscription;
+    subscription.id = ++m_lastId;
+    subscription.receiver = receiver;
+    subscription.handler = std::move(handler);
+
+    for (const auto type : types) {
+        m_routes[type] << subscription;
+    }
+
+    connect(receiver, &QObject::destroyed, this, &EventsRouter::onReceiverDestroyed, Qt::UniqueConnection);
+
+    return subscription.id;
+}
+
+void EventsRouter::unsubscribe(int id)
+{
+    for (auto it = m_routes.begin(); it != m_routes.end();) {
+        it.value().removeIf([id](const Subscription &subscription) {
+            return subscription.id == id;
+        });
+
+        if (it.value().isEmpty()) {
+            it = m_routes.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void EventsRouter::setArea(int id, const QRegion &area)
+{
+    for (auto &subscriptions : m_routes) {
+        for (auto &subscription : subscriptions) {
+            if (subscription.id == id) {
+                subscription.area = area;
+            }
+        }
+    }
+}
+
+void EventsRouter::onReceiverDestroyed(QObject *receiver)
+{
+    for (auto it = m_routes.begin(); it != m_routes.end();) {
+        it.value().removeIf([receiver](const Subscription &subscription) {
+            return subscription.receiver.isNull() || subscription.receiver == receiver;
+        });
+
+        if (it.value().isEmpty()) {
+            it = m_routes.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+bool EventsRouter::pointerPosition(QEvent *e, QPointF &position)
+{
+    if (e->isSinglePointEvent()) {
+        position = static_cast<QSinglePointEvent *>(e)->scenePosition();
+        return true;
+    }
+
+    switch (e->type()) {
+    case QEvent::DragEnter:
+    case QEvent::DragMove:
+    case QEvent::Drop:
+        position = static_cast<QDropEvent *>(e)->position();
+        return true;
+    default:
+        return false;
+    }
+}
+
+void EventsRouter::route(QEvent *e)
+{
+    if (!e) {
+        return;
+    }
+
+    auto route = m_routes.constFind(e->type());
+
+    if (route == m_routes.constEnd()) {
+        return;
+    }
+
+    //! shallow copy, no allocation unless a handler changes the subscriptions
+    const QList<Subscription> subscriptions = route.value();
+
+    bool positionResolved{false};
+    bool hasPosition{false};
+    QPointF position;
+
+    for (const auto &subscription : subscriptions) {
+        if (!subscription.receiver) {
+            continue;
+        }
+
+        if (!subscription.area.isEmpty()) {
+            if (!positionResolved) {
+                hasPosition = pointerPosition(e, position);
+                positionResolved = true;
+            }
+
+            if (hasPosition && !subscription.area.contains(position.toPoint())) {
+                continue;
+            }
+        }
+
+        subscription.handler(e);
+    }
+}
+
+}
+}
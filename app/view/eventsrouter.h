@@ -0,0 +1,78 @@
+/* This file is a part of the Atmo desktop experience's SynDock project for SynOS.
+ * Copyright (C) 2026 Syndromatic Ltd. All rights reserved
+ * Designed by Kavish Krishnakumar in Manchester.
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#ifndef VIEWEVENTSROUTER_H
+#define VIEWEVENTSROUTER_H
+
+// Qt
+#include <QEvent>
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QPointer>
+#include <QRegion>
+
+// C++
+#include <functional>
+#include <initializer_list>
+
+namespace NSE {
+class View;
+}
+
+namespace NSE {
+namespace ViewPart {
+
+//! Delivers the events of a view only to the parts that subscribed for their type.
+//! Pointer events can be limited further to an area in scene coordinates. Events
+//! that nobody subscribed for cost a single lookup.
+class EventsRouter: public QObject
+{
+    Q_OBJECT
+
+public:
+    using Handler = std::function<void(QEvent *)>;
+
+    EventsRouter(NSE::View *parent);
+    virtual ~EventsRouter();
+
+    //! subscriptions are removed automatically when their receiver is destroyed
+    int subscribe(QObject *receiver, std::initializer_list<QEvent::Type> types, Handler handler);
+    void unsubscribe(int id);
+
+    //! empty area means the whole view
+    void setArea(int id, const QRegion &area);
+
+    void route(QEvent *e);
+
+private slots:
+    void onReceiverDestroyed(QObject *receiver);
+
+private:
+    struct Subscription {
+        int id{0};
+        QPointer<QObject> receiver;
+        QRegion area;
+        Handler handler;
+    };
+
+    static bool pointerPosition(QEvent *e, QPointF &position);
+
+private:
+    int m_lastId{0};
+
+    //! subscriptions per event type, dispatching works on implicitly shared copies so
+    //! handlers can safely unsubscribe while an event is delivered
+    QHash<int, QList<Subscription>> m_routes;
+
+    QPointer<NSE::View> m_view;
+};
+
+}
+}
+
+#endif
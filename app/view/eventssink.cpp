@@ -16,6 +16,7 @@
 #include <QMouseEvent>
 #include <QPointF>
 #include <QRectF>
+#include <QWheelEvent>
 
 
 namespace NSE {
@@ -63,146 +64,125 @@ void EventsSink::release()
     setSink(nullptr, nullptr);
 }
 
-QEvent *EventsSink::onEvent(QEvent *e)
+bool EventsSink::sinkEvent(QEvent *e, const std::function<bool(QEvent *)> &deliver)
 {
     if (!e) {
-        return nullptr;
+        return false;
     }
 
     if (!isActive()) {
-        return e;
+        return deliver(e);
     }
 
-    QEvent *sunkevent = e;
-
     switch (e->type()) {
     case QEvent::Leave:
         release();
         break;
-    case QEvent::DragEnter:
-        if (auto de = static_cast<QDragEnterEvent *>(e)) {
-            QPointF point = de->posF();
-            if (originSinksContain(point)) {
-                auto de2 = new QDragEnterEvent(positionAdjustedForDestination(point).toPoint(),
-                                               de->possibleActions(),
-                                               de->mimeData(),
-                                               de->mouseButtons(),
-                                               de->keyboardModifiers());
-                sunkevent = de2;
-            } else if (!destinationContains(point)) {
-                release();
-            }
-        }
-        break;
 
+    case QEvent::DragEnter:
     case QEvent::DragMove:
-        if (auto de = static_cast<QDragMoveEvent *>(e)) {
-            QPointF point = de->posF();
-            if (originSinksContain(point)) {
-                auto de2 = new QDragMoveEvent(positionAdjustedForDestination(point).toPoint(),
-                                              de->possibleActions(),
-                                              de->mimeData(),
-                                              de->mouseButtons(),
-                                              de->keyboardModifiers());
-
-                sunkevent = de2;
-            } else if (!destinationContains(point)) {
-                release();
-            }
-        }
-        break;
-
     case QEvent::Drop:
-        if (auto de = static_cast<QDropEvent *>(e)) {
-            QPointF point = de->posF();
-            if (originSinksContain(point)) {
-                auto de2 = new QDropEvent(positionAdjustedForDestination(point).toPoint(),
-                                          de->possibleActions(),
-                                          de->mimeData(),
-                                          de->mouseButtons(),
-                                          de->keyboardModifiers());
-
-                sunkevent = de2;
-            } else if (!destinationContains(point)) {
-                release();
-            }
-        }
-
-        break;
+        return sinkDragEvent(static_cast<QDropEvent *>(e), deliver);
 
     case QEvent::MouseMove:
-        if (auto me = dynamic_cast<QMouseEvent *>(e)) {
-            if (m_view->positioner() && m_view->positioner()->isCursorInsideView() && originSinksContain(me->windowPos())) {
-                auto positionadjusted = positionAdjustedForDestination(me->windowPos());
-                auto me2 = new QMouseEvent(me->type(),
-                                           positionadjusted,
-                                           positionadjusted,
-                                           positionadjusted + m_view->position(),
-                                           me->button(), me->buttons(), me->modifiers());
-
-                sunkevent = me2;
-            } else if (!destinationContains(me->windowPos())) {
-                release();
-            }
-        }
+    case QEvent::MouseButtonPress:
+    case QEvent::MouseButtonRelease:
+        return sinkMouseEvent(static_cast<QMouseEvent *>(e), deliver);
+
+    case QEvent::Wheel:
+        return sinkWheelEvent(static_cast<QWheelEvent *>(e), deliver);
+
+    default:
         break;
+    }
 
-    case QEvent::MouseButtonPress:
-        if (auto me = dynamic_cast<QMouseEvent *>(e)) {
-            if (originSinksContain(me->windowPos())) {
-                auto positionadjusted = positionAdjustedForDestination(me->windowPos());
-                auto me2 = new QMouseEvent(me->type(),
-                                           positionadjusted,
-                                           positionadjusted,
-                                           positionadjusted + m_view->position(),
-                                           me->button(), me->buttons(), me->modifiers());
-
-                qDebug() << "Sunk Event:: sunk event pressed...";
-                sunkevent = me2;
-            } else if (!destinationContains(me->windowPos())) {
-                release();
-            }
+    return deliver(e);
+}
+
+bool EventsSink::sinkDragEvent(QDropEvent *e, const std::function<bool(QEvent *)> &deliver)
+{
+    QPointF point = e->position();
+
+    if (!originSinksContain(point)) {
+        if (!destinationContains(point)) {
+            release();
         }
-        break;
 
-    case QEvent::MouseButtonRelease:
-        if (auto me = dynamic_cast<QMouseEvent *>(e)) {
-            if (originSinksContain(me->windowPos())) {
-                auto positionadjusted = positionAdjustedForDestination(me->windowPos());
-                auto me2 = new QMouseEvent(me->type(),
-                                           positionadjusted,
-                                           positionadjusted,
-                                           positionadjusted + m_view->position(),
-                                           me->button(), me->buttons(), me->modifiers());
-
-                sunkevent = me2;
-            } else if (!destinationContains(me->windowPos())) {
-                release();
-            }
+        return deliver(e);
+    }
+
+    QPoint adjusted = positionAdjustedForDestination(point).toPoint();
+    bool result{false};
+
+    if (e->type() == QEvent::DragEnter) {
+        QDragEnterEvent sunk(adjusted, e->possibleActions(), e->mimeData(), e->buttons(), e->modifiers());
+        result = deliver(&sunk);
+        e->setDropAction(sunk.dropAction());
+        e->setAccepted(sunk.isAccepted());
+    } else if (e->type() == QEvent::DragMove) {
+        QDragMoveEvent sunk(adjusted, e->possibleActions(), e->mimeData(), e->buttons(), e->modifiers());
+        result = deliver(&sunk);
+        e->setDropAction(sunk.dropAction());
+        e->setAccepted(sunk.isAccepted());
+    } else {
+        QDropEvent sunk(adjusted, e->possibleActions(), e->mimeData(), e->buttons(), e->modifiers());
+        result = deliver(&sunk);
+        e->setDropAction(sunk.dropAction());
+        e->setAccepted(sunk.isAccepted());
+    }
+
+    return result;
+}
+
+bool EventsSink::sinkMouseEvent(QMouseEvent *e, const std::function<bool(QEvent *)> &deliver)
+{
+    QPointF point = e->scenePosition();
+
+    bool sinkable = originSinksContain(point);
+
+    if (e->type() == QEvent::MouseMove) {
+        sinkable = sinkable && m_view->positioner() && m_view->positioner()->isCursorInsideView();
+    }
+
+    if (!sinkable) {
+        if (!destinationContains(point)) {
+            release();
         }
-        break;
 
-    case QEvent::Wheel:
-        if (auto we = dynamic_cast<QWheelEvent *>(e)) {
-            QPoint pos = we->position().toPoint();
-            if (originSinksContain(pos)) {
-                auto positionadjusted = positionAdjustedForDestination(pos);
-                auto we2 = new QWheelEvent(positionadjusted,
-                                           positionadjusted + m_view->position(),
-                                           we->pixelDelta(), we->angleDelta(), we->angleDelta().y(),
-                                           we->orientation(), we->buttons(), we->modifiers(), we->phase());
-
-                sunkevent = we2;
-            } else if (!destinationContains(pos)) {
-                release();
-            }
+        return deliver(e);
+    }
+
+    QPointF adjusted = positionAdjustedForDestination(point);
+    QMouseEvent sunk(e->type(), adjusted, adjusted, adjusted + m_view->position(),
+                     e->button(), e->buttons(), e->modifiers(), e->pointingDevice());
+
+    bool result = deliver(&sunk);
+    e->setAccepted(sunk.isAccepted());
+
+    return result;
+}
+
+bool EventsSink::sinkWheelEvent(QWheelEvent *e, const std::function<bool(QEvent *)> &deliver)
+{
+    QPointF point = e->position();
+
+    if (!originSinksContain(point)) {
+        if (!destinationContains(point)) {
+            release();
         }
-        break;
-    default:
-        break;
+
+        return deliver(e);
     }
 
-    return sunkevent;
+    QPointF adjusted = positionAdjustedForDestination(point);
+    QWheelEvent sunk(adjusted, adjusted + m_view->position(),
+                     e->pixelDelta(), e->angleDelta(), e->buttons(), e->modifiers(),
+                     e->phase(), e->inverted(), Qt::MouseEventNotSynthesized, e->pointingDevice());
+
+    bool result = deliver(&sunk);
+    e->setAccepted(sunk.isAccepted());
+
+    return result;
 }
 
 QPointF EventsSink::positionAdjustedForDestination(const QPointF &point) const
@@ -222,16 +202,17 @@ bool EventsSink::destinationContains(const QPointF &point) const
 
 bool EventsSink::originSinksContain(const QPointF &point) const
 {
-    QRegion originsRegion;
-
+    //! checked per child instead of uniting their geometries, pointer moves are frequent
     for(const auto currentOrigin: m_originParentItem->childItems()) {
         QRectF currentOriginGeometry = currentOrigin->mapRectToScene(QRectF(0, 0, currentOrigin->width(), currentOrigin->height()));
-        originsRegion = originsRegion.united(currentOriginGeometry.toRect());
+
+        if (currentOriginGeometry.toRect().contains(point.toPoint())) {
+            return true;
+        }
     }
 
-    return originsRegion.contains(point.toPoint());
+    return false;
 }
 
 }
 }
-
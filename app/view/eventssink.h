@@ -13,6 +13,13 @@
 #include <QPointer>
 #include <QQuickItem>
 
+// C++
+#include <functional>
+
+class QDropEvent;
+class QMouseEvent;
+class QWheelEvent;
+
 namespace NSE {
 class View;
 }
@@ -41,11 +48,14 @@ public:
     QQuickItem *originParentItem() const;
     QQuickItem *destinationItem() const;
 
+    //! delivers the event through deliver, or its counterpart for the destination item when the
+    //! event is sunk. Sunk events live on the stack for the delivery only, so nothing is allocated
+    //! per event and nested deliveries (e.g. menus opened from a press) remain valid
+    bool sinkEvent(QEvent *e, const std::function<bool(QEvent *)> &deliver);
+
 public slots:
     Q_INVOKABLE void setSink(QQuickItem *originParent, QQuickItem *destination);
 
-    QEvent *onEvent(QEvent *e);
-
 signals:
     void itemsChanged();
 
@@ -53,6 +63,10 @@ private slots:
     void release();
 
 private:
+    bool sinkDragEvent(QDropEvent *e, const std::function<bool(QEvent *)> &deliver);
+    bool sinkMouseEvent(QMouseEvent *e, const std::function<bool(QEvent *)> &deliver);
+    bool sinkWheelEvent(QWheelEvent *e, const std::function<bool(QEvent *)> &deliver);
+
     QPointF positionAdjustedForDestination(const QPointF &point) const;
 
     bool originSinksContain(const QPointF &point) const;
@@ -52,10 +52,10 @@ NSEParabolicEffect::NSEParabolicEffect(NSE::View *parent)
     connect(this, &NSEParabolicEffect::currentItemChanged, 
             this, &NSEParabolicEffect::onCurrentItemChanged);
     
-    // Connect to view events for mouse tracking
+    // Subscribe only to the view events needed for mouse tracking
     if (m_view) {
-        connect(m_view, &NSE::View::eventTriggered, 
-                this, &NSEParabolicEffect::onViewEvent);
+        m_view->eventsRouter()->subscribe(this, {QEvent::Leave, QEvent::MouseMove},
+                                          [this](QEvent *e) { onViewEvent(e); });
     }
     
     qCInfo(nseParabolic) << "NSE Parabolic Effect initialised"
@@ -29,7 +29,9 @@ Parabolic::Parabolic(NSE::View *parent)
 
     connect(this, &Parabolic::currentParabolicItemChanged, this, &Parabolic::onCurrentParabolicItemChanged);
 
-    connect(m_view, &View::eventTriggered, this, &Parabolic::onEvent);
+    m_view->eventsRouter()->subscribe(this, {QEvent::Leave, QEvent::MouseMove}, [this](QEvent *e) {
+        onEvent(e);
+    });
 }
 
 Parabolic::~Parabolic()
@@ -0,0 +1,376 @@
+/* This file is a part of the Atmo desktop experience's SynDock project for SynOS.
+ * Copyright (C) 2026 Syndromatic Ltd. All rights reserved
+ * Designed by Kavish Krishnakumar in Manchester.
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "surfacegeometry.h"
+
+// local
+#include "effects.h"
+#include "view.h"
+#include "visibilitymanager.h"
+
+// KDE
+#include <KWindowSystem>
+
+namespace NSE {
+namespace ViewPart {
+
+SurfaceGeometry::SurfaceGeometry(NSE::View *parent)
+    : QObject(parent),
+      m_view(parent)
+{
+    connect(this, &SurfaceGeometry::metricsChanged, this, &SurfaceGeometry::update);
+    connect(this, &SurfaceGeometry::statesChanged, this, &SurfaceGeometry::update);
+    connect(this, &SurfaceGeometry::backgroundItemChanged, this, &SurfaceGeometry::trackBackgroundItem);
+
+    connect(m_view, &QQuickWindow::widthChanged, this, &SurfaceGeometry::update);
+    connect(m_view, &QQuickWindow::heightChanged, this, &SurfaceGeometry::update);
+    connect(m_view, &NSE::View::behaveAsPlasmaPanelChanged, this, &SurfaceGeometry::update);
+    connect(m_view, &NSE::View::locationChanged, this, &SurfaceGeometry::update);
+    connect(m_view, &NSE::View::visibilityChanged, this, &SurfaceGeometry::onVisibilityChanged);
+    connect(KWindowSystem::self(), &KWindowSystem::compositingChanged, this, &SurfaceGeometry::update);
+}
+
+SurfaceGeometry::~SurfaceGeometry()
+{
+}
+
+QQuickItem *SurfaceGeometry::backgroundItem() const
+{
+    return m_backgroundItem;
+}
+
+void SurfaceGeometry::setBackgroundItem(QQuickItem *item)
+{
+    if (m_backgroundItem == item) {
+        return;
+    }
+
+    m_backgroundItem = item;
+    emit backgroundItemChanged();
+}
+
+int SurfaceGeometry::thickness() const
+{
+    return m_thickness;
+}
+
+void SurfaceGeometry::setThickness(int thickness)
+{
+    if (m_thickness == thickness) {
+        return;
+    }
+
+    m_thickness = thickness;
+    emit metricsChanged();
+}
+
+int SurfaceGeometry::hiddenThickness() const
+{
+    return m_hiddenThickness;
+}
+
+void SurfaceGeometry::setHiddenThickness(int thickness)
+{
+    if (m_hiddenThickness == thickness) {
+        return;
+    }
+
+    m_hiddenThickness = thickness;
+    emit metricsChanged();
+}
+
+int SurfaceGeometry::zoomedThickness() const
+{
+    return m_zoomedThickness;
+}
+
+void SurfaceGeometry::setZoomedThickness(int thickness)
+{
+    if (m_zoomedThickness == thickness) {
+        return;
+    }
+
+    m_zoomedThickness = thickness;
+    emit metricsChanged();
+}
+
+int SurfaceGeometry::screenEdgeMargin() const
+{
+    return m_screenEdgeMargin;
+}
+
+void SurfaceGeometry::setScreenEdgeMargin(int margin)
+{
+    if (m_screenEdgeMargin == margin) {
+        return;
+    }
+
+    m_screenEdgeMargin = margin;
+    emit metricsChanged();
+}
+
+int SurfaceGeometry::floatingGapMargin() const
+{
+    return m_floatingGapMargin;
+}
+
+void SurfaceGeometry::setFloatingGapMargin(int margin)
+{
+    if (m_floatingGapMargin == margin) {
+        return;
+    }
+
+    m_floatingGapMargin = margin;
+    emit metricsChanged();
+}
+
+bool SurfaceGeometry::animated() const
+{
+    return m_animated;
+}
+
+void SurfaceGeometry::setAnimated(bool animated)
+{
+    if (m_animated == animated) {
+        return;
+    }
+
+    m_animated = animated;
+    emit statesChanged();
+}
+
+bool SurfaceGeometry::normalState() const
+{
+    return m_normalState;
+}
+
+void SurfaceGeometry::setNormalState(bool normal)
+{
+    if (m_normalState == normal) {
+        return;
+    }
+
+    m_normalState = normal;
+    emit statesChanged();
+}
+
+bool SurfaceGeometry::updateEnabled() const
+{
+    return m_updateEnabled;
+}
+
+void SurfaceGeometry::setUpdateEnabled(bool enabled)
+{
+    if (m_updateEnabled == enabled) {
+        return;
+    }
+
+    m_updateEnabled = enabled;
+    emit statesChanged();
+}
+
+bool SurfaceGeometry::floatingGapInputDisabled() const
+{
+    return m_floatingGapInputDisabled;
+}
+
+void SurfaceGeometry::setFloatingGapInputDisabled(bool disabled)
+{
+    if (m_floatingGapInputDisabled == disabled) {
+        return;
+    }
+
+    m_floatingGapInputDisabled = disabled;
+    emit statesChanged();
+}
+
+void SurfaceGeometry::trackBackgroundItem()
+{
+    for (const auto &connection : m_itemConnections) {
+        disconnect(connection);
+    }
+
+    m_itemConnections.clear();
+
+    for (QQuickItem *item = m_backgroundItem; item; item = item->parentItem()) {
+        m_itemConnections << connect(item, &QQuickItem::xChanged, this, &SurfaceGeometry::update);
+        m_itemConnections << connect(item, &QQuickItem::yChanged, this, &SurfaceGeometry::update);
+        m_itemConnections << connect(item, &QQuickItem::parentChanged, this, &SurfaceGeometry::trackBackgroundItem);
+
+        if (item == m_backgroundItem) {
+            m_itemConnections << connect(item, &QQuickItem::widthChanged, this, &SurfaceGeometry::update);
+            m_itemConnections << connect(item, &QQuickItem::heightChanged, this, &SurfaceGeometry::update);
+        }
+    }
+
+    update();
+}
+
+void SurfaceGeometry::onVisibilityChanged()
+{
+    for (const auto &connection : m_visibilityConnections) {
+        disconnect(connection);
+    }
+
+    m_visibilityConnections.clear();
+
+    if (auto visibility = m_view->visibility()) {
+        m_visibilityConnections << connect(visibility, &VisibilityManager::isHiddenChanged, this, &SurfaceGeometry::update);
+        m_visibilityConnections << connect(visibility, &VisibilityManager::isSidebarChanged, this, &SurfaceGeometry::update);
+    }
+
+    update();
+}
+
+void SurfaceGeometry::update()
+{
+    if (!m_view || !m_view->effects()) {
+        return;
+    }
+
+    auto effects = m_view->effects();
+
+    if (m_backgroundItem) {
+        effects->setRect(effectsRect());
+    }
+
+    bool isHidden = m_view->visibility() && m_view->visibility()->isHidden();
+
+    if (!isHidden && m_updateEnabled && m_normalState) {
+        //! Important: Local Geometry must not be updated when view ISHIDDEN
+        //! because it breaks Dodge(s) modes in such case
+        m_view->setLocalGeometry(localGeometry(effects->rect()));
+    }
+
+    if (m_updateEnabled) {
+        effects->setInputMask(inputMask(m_view->localGeometry()));
+    }
+}
+
+QRect SurfaceGeometry::effectsRect() const
+{
+    QRect backgroundRect = m_backgroundItem->mapRectToScene(QRectF(0, 0, m_backgroundItem->width(), m_backgroundItem->height())).toRect();
+
+    if (!KWindowSystem::compositingActive()) {
+        //! NOCOMPOSITING mode is a special case and Effects Area is also used for
+        //! different calculations for View::mask()
+        return backgroundRect;
+    }
+
+    if (m_view->visibility() && m_view->visibility()->isHidden()) {
+        //! valid hide mask
+        return QRect(-1, -1, 1, 1);
+    }
+
+    if (m_view->behaveAsPlasmaPanel()) {
+        return QRect(0, 0, backgroundRect.width(), backgroundRect.height());
+    }
+
+    return backgroundRect;
+}
+
+QRect SurfaceGeometry::localGeometry(const QRect &effectsRect) const
+{
+    const int viewWidth = m_view->width();
+    const int viewHeight = m_view->height();
+
+    if (m_view->behaveAsPlasmaPanel()) {
+        return QRect(0, 0, viewWidth, viewHeight);
+    }
+
+    //! the shadows size must be removed from the local geometry, the length comes from effects area
+    QRect local(0, 0, viewWidth, viewHeight);
+
+    switch (m_view->location()) {
+    case Plasma::Types::TopEdge:
+        local = QRect(effectsRect.x(), m_screenEdgeMargin, effectsRect.width(), m_thickness);
+        break;
+    case Plasma::Types::BottomEdge:
+        local = QRect(effectsRect.x(), viewHeight - m_thickness - m_screenEdgeMargin, effectsRect.width(), m_thickness);
+        break;
+    case Plasma::Types::LeftEdge:
+        local = QRect(m_screenEdgeMargin, effectsRect.y(), m_thickness, effectsRect.height());
+        break;
+    case Plasma::Types::RightEdge:
+        local = QRect(viewWidth - m_thickness - m_screenEdgeMargin, effectsRect.y(), m_thickness, effectsRect.height());
+        break;
+    default:
+        break;
+    }
+
+    return boundedToView(local);
+}
+
+QRect SurfaceGeometry::inputMask(const QRect &localGeometry) const
+{
+    if (!KWindowSystem::compositingActive() || m_view->behaveAsPlasmaPanel()) {
+        //! clear input mask
+        return QRect(0, 0, -1, -1);
+    }
+
+    const int viewWidth = m_view->width();
+    const int viewHeight = m_view->height();
+
+    bool isHidden = m_view->visibility() && m_view->visibility()->isHidden();
+    bool isSidebar = m_view->visibility() && m_view->visibility()->isSidebar();
+
+    if (isSidebar && isHidden) {
+        //! this way we make sure than no input is accepted anywhere
+        return QRect(-1, -1, 1, 1);
+    }
+
+    //! inputThickness is used when items are zoomed in order to workaround faulty
+    //! onEntered() signals from parabolic mouse areas
+    int inputThickness{0};
+
+    if (isHidden) {
+        inputThickness = m_hiddenThickness;
+    } else if (m_floatingGapInputDisabled) {
+        inputThickness = m_animated ? m_zoomedThickness - m_floatingGapMargin : m_thickness;
+    } else {
+        inputThickness = m_animated ? m_zoomedThickness : m_screenEdgeMargin + m_thickness;
+    }
+
+    int subtractedScreenEdge = (m_floatingGapInputDisabled && !isHidden) ? m_screenEdgeMargin : 0;
+
+    //! when zoomed the whole view length accepts input, otherwise the local geometry length
+    QRect input(0, 0, viewWidth, viewHeight);
+
+    switch (m_view->location()) {
+    case Plasma::Types::TopEdge:
+        input = QRect(m_animated ? 0 : localGeometry.x(), subtractedScreenEdge,
+                      m_animated ? viewWidth : localGeometry.width(), inputThickness);
+        break;
+    case Plasma::Types::BottomEdge:
+        input = QRect(m_animated ? 0 : localGeometry.x(), viewHeight - inputThickness - subtractedScreenEdge,
+                      m_animated ? viewWidth : localGeometry.width(), inputThickness);
+        break;
+    case Plasma::Types::LeftEdge:
+        input = QRect(subtractedScreenEdge, m_animated ? 0 : localGeometry.y(),
+                      inputThickness, m_animated ? viewHeight : localGeometry.height());
+        break;
+    case Plasma::Types::RightEdge:
+        input = QRect(viewWidth - inputThickness - subtractedScreenEdge, m_animated ? 0 : localGeometry.y(),
+                      inputThickness, m_animated ? viewHeight : localGeometry.height());
+        break;
+    default:
+        break;
+    }
+
+    return boundedToView(input);
+}
+
+QRect SurfaceGeometry::boundedToView(const QRect &rect) const
+{
+    return QRect(qBound(0, rect.x(), m_view->width()),
+                 qBound(0, rect.y(), m_view->height()),
+                 qMin(rect.width(), m_view->width()),
+                 qMin(rect.height(), m_view->height()));
+}
+
+}
+}
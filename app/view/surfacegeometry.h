@@ -0,0 +1,126 @@
+/* This file is a part of the Atmo desktop experience's SynDock project for SynOS.
+ * Copyright (C) 2026 Syndromatic Ltd. All rights reserved
+ * Designed by Kavish Krishnakumar in Manchester.
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#ifndef VIEWSURFACEGEOMETRY_H
+#define VIEWSURFACEGEOMETRY_H
+
+// Qt
+#include <QList>
+#include <QMetaObject>
+#include <QObject>
+#include <QPointer>
+#include <QQuickItem>
+#include <QRect>
+
+namespace NSE {
+class View;
+}
+
+namespace NSE {
+namespace ViewPart {
+
+//! Derives the effects area, the view local geometry and the input mask from the
+//! background item geometry and a few metrics that qml publishes. The derived areas
+//! are updated synchronously whenever any of their sources changes.
+class SurfaceGeometry: public QObject
+{
+    Q_OBJECT
+    //! the item whose geometry defines the effects area, usually the view background
+    Q_PROPERTY(QQuickItem *backgroundItem READ backgroundItem WRITE setBackgroundItem NOTIFY backgroundItemChanged)
+
+    //! view thickness without the screen edge margin and shadows
+    Q_PROPERTY(int thickness READ thickness WRITE setThickness NOTIFY metricsChanged)
+    //! thickness that accepts input while the view is hidden
+    Q_PROPERTY(int hiddenThickness READ hiddenThickness WRITE setHiddenThickness NOTIFY metricsChanged)
+    //! thickness that accepts input while items are zoomed
+    Q_PROPERTY(int zoomedThickness READ zoomedThickness WRITE setZoomedThickness NOTIFY metricsChanged)
+    Q_PROPERTY(int screenEdgeMargin READ screenEdgeMargin WRITE setScreenEdgeMargin NOTIFY metricsChanged)
+    //! floating gap margin that is excluded from input while zoomed and input in floating gap is disabled
+    Q_PROPERTY(int floatingGapMargin READ floatingGapMargin WRITE setFloatingGapMargin NOTIFY metricsChanged)
+
+    Q_PROPERTY(bool animated READ animated WRITE setAnimated NOTIFY statesChanged)
+    Q_PROPERTY(bool normalState READ normalState WRITE setNormalState NOTIFY statesChanged)
+    Q_PROPERTY(bool updateEnabled READ updateEnabled WRITE setUpdateEnabled NOTIFY statesChanged)
+    Q_PROPERTY(bool floatingGapInputDisabled READ floatingGapInputDisabled WRITE setFloatingGapInputDisabled NOTIFY statesChanged)
+
+public:
+    SurfaceGeometry(NSE::View *parent);
+    virtual ~SurfaceGeometry();
+
+    QQuickItem *backgroundItem() const;
+    void setBackgroundItem(QQuickItem *item);
+
+    int thickness() const;
+    void setThickness(int thickness);
+
+    int hiddenThickness() const;
+    void setHiddenThickness(int thickness);
+
+    int zoomedThickness() const;
+    void setZoomedThickness(int thickness);
+
+    int screenEdgeMargin() const;
+    void setScreenEdgeMargin(int margin);
+
+    int floatingGapMargin() const;
+    void setFloatingGapMargin(int margin);
+
+    bool animated() const;
+    void setAnimated(bool animated);
+
+    bool normalState() const;
+    void setNormalState(bool normal);
+
+    bool updateEnabled() const;
+    void setUpdateEnabled(bool enabled);
+
+    bool floatingGapInputDisabled() const;
+    void setFloatingGapInputDisabled(bool disabled);
+
+public slots:
+    Q_INVOKABLE void update();
+
+signals:
+    void backgroundItemChanged();
+    void metricsChanged();
+    void statesChanged();
+
+private slots:
+    void trackBackgroundItem();
+    void onVisibilityChanged();
+
+private:
+    QRect effectsRect() const;
+    QRect localGeometry(const QRect &effectsRect) const;
+    QRect inputMask(const QRect &localGeometry) const;
+
+    QRect boundedToView(const QRect &rect) const;
+
+private:
+    bool m_animated{false};
+    bool m_normalState{true};
+    bool m_updateEnabled{false};
+    bool m_floatingGapInputDisabled{false};
+
+    int m_thickness{0};
+    int m_hiddenThickness{0};
+    int m_zoomedThickness{0};
+    int m_screenEdgeMargin{0};
+    int m_floatingGapMargin{0};
+
+    QPointer<NSE::View> m_view;
+    QPointer<QQuickItem> m_backgroundItem;
+
+    //! connections to the background item and its ancestors, any of them moving moves the effects area
+    QList<QMetaObject::Connection> m_itemConnections;
+    QList<QMetaObject::Connection> m_visibilityConnections;
+};
+
+}
+}
+
+#endif
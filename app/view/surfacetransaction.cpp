@@ -0,0 +1,185 @@
+/* This file is a part of the Atmo desktop experience's SynDock project for SynOS.
+ * Copyright (C) 2026 Syndromatic Ltd. All rights reserved
+ * Designed by Kavish Krishnakumar in Manchester.
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "surfacetransaction.h"
+
+// local
+#include "view.h"
+
+// Qt
+#include <QHashFunctions>
+
+// KDE
+#include <KWindowEffects>
+#include <KWindowSystem>
+
+namespace NSE {
+namespace ViewPart {
+
+SurfaceTransaction::SurfaceTransaction(NSE::View *parent)
+    : QObject(parent),
+      m_view(parent)
+{
+    //! changes that are not triggered from the animation phase of a frame are
+    //! published at the next event loop iteration, all together
+    m_commitTimer.setInterval(0);
+    m_commitTimer.setSingleShot(true);
+    connect(&m_commitTimer, &QTimer::timeout, this, &SurfaceTransaction::commit);
+
+    //! afterAnimating is emitted from the gui thread after QML animations advanced and
+    //! before the scene is synchronized, so parabolic/slide animations publish once per frame
+    connect(m_view, &QQuickWindow::afterAnimating, this, &SurfaceTransaction::commit);
+}
+
+SurfaceTransaction::~SurfaceTransaction()
+{
+}
+
+uint SurfaceTransaction::regionHash(const QRegion &region)
+{
+    size_t seed{0};
+
+    for (const QRect &rect : region) {
+        seed = qHashMulti(seed, rect.x(), rect.y(), rect.width(), rect.height());
+    }
+
+    return static_cast<uint>(seed);
+}
+
+bool SurfaceTransaction::sameRegion(const RegionState &state, bool enabled, const QRegion &region, uint hash)
+{
+    if (state.enabled != enabled) {
+        return false;
+    }
+
+    if (!enabled) {
+        return true;
+    }
+
+    return (state.hash == hash && state.region == region);
+}
+
+void SurfaceTransaction::setMask(const QRegion &region)
+{
+    m_pendingMask.enabled = true;
+    m_pendingMask.region = region;
+    m_pendingMask.hash = regionHash(region);
+
+    m_maskDirty = true;
+    scheduleCommit();
+}
+
+void SurfaceTransaction::setBlurBehind(bool enabled, const QRegion &region)
+{
+    m_pendingBlur.enabled = enabled;
+    m_pendingBlur.region = enabled ? region : QRegion();
+    m_pendingBlur.hash = enabled ? regionHash(region) : 0;
+
+    m_blurDirty = true;
+    scheduleCommit();
+}
+
+void SurfaceTransaction::setBackgroundContrast(bool enabled, qreal contrast, qreal intensity, qreal saturation, const QRegion &region)
+{
+    m_pendingContrast.area.enabled = enabled;
+    m_pendingContrast.area.region = enabled ? region : QRegion();
+    m_pendingContrast.area.hash = enabled ? regionHash(region) : 0;
+    m_pendingContrast.contrast = contrast;
+    m_pendingContrast.intensity = intensity;
+    m_pendingContrast.saturation = saturation;
+
+    m_contrastDirty = true;
+    scheduleCommit();
+}
+
+void SurfaceTransaction::scheduleCommit()
+{
+    m_scheduled = true;
+
+    if (!m_committing && !m_commitTimer.isActive()) {
+        m_commitTimer.start();
+    }
+}
+
+void SurfaceTransaction::invalidate()
+{
+    m_hasCommittedMask = false;
+    m_hasCommittedBlur = false;
+    m_hasCommittedContrast = false;
+
+    m_maskDirty = true;
+    m_blurDirty = true;
+    m_contrastDirty = true;
+    scheduleCommit();
+}
+
+void SurfaceTransaction::commit()
+{
+    if (!m_scheduled || m_committing || !m_view) {
+        return;
+    }
+
+    m_committing = true;
+    emit aboutToCommit();
+    m_committing = false;
+
+    m_scheduled = false;
+    m_commitTimer.stop();
+
+    if (m_maskDirty && m_pendingMask.enabled) {
+        m_maskDirty = false;
+
+        if (!m_hasCommittedMask || !sameRegion(m_committedMask, true, m_pendingMask.region, m_pendingMask.hash)) {
+            m_view->setMask(m_pendingMask.region);
+            m_committedMask = m_pendingMask;
+            m_hasCommittedMask = true;
+        }
+    }
+
+    //! Don't apply any effect before the wayland surface is created under wayland
+    //! https://bugs.kde.org/show_bug.cgi?id=392890
+    if (KWindowSystem::isPlatformWayland() && !m_view->surface()) {
+        //! effects stay dirty and scheduled until the surface is created
+        m_scheduled = (m_blurDirty || m_contrastDirty);
+        return;
+    }
+
+    if (m_blurDirty) {
+        m_blurDirty = false;
+
+        if (!m_hasCommittedBlur || !sameRegion(m_committedBlur, m_pendingBlur.enabled, m_pendingBlur.region, m_pendingBlur.hash)) {
+            KWindowEffects::enableBlurBehind(m_view->winId(), m_pendingBlur.enabled, m_pendingBlur.region);
+            m_committedBlur = m_pendingBlur;
+            m_hasCommittedBlur = true;
+        }
+    }
+
+    if (m_contrastDirty) {
+        m_contrastDirty = false;
+
+        const ContrastState &pending = m_pendingContrast;
+        bool sameValues = (m_committedContrast.contrast == pending.contrast
+                           && m_committedContrast.intensity == pending.intensity
+                           && m_committedContrast.saturation == pending.saturation);
+
+        if (!m_hasCommittedContrast
+                || !sameValues
+                || !sameRegion(m_committedContrast.area, pending.area.enabled, pending.area.region, pending.area.hash)) {
+            KWindowEffects::enableBackgroundContrast(m_view->winId(),
+                                                     pending.area.enabled,
+                                                     pending.contrast,
+                                                     pending.intensity,
+                                                     pending.saturation,
+                                                     pending.area.region);
+            m_committedContrast = pending;
+            m_hasCommittedContrast = true;
+        }
+    }
+}
+
+}
+}
@@ -0,0 +1,102 @@
+/* This file is a part of the Atmo desktop experience's SynDock project for SynOS.
+ * Copyright (C) 2026 Syndromatic Ltd. All rights reserved
+ * Designed by Kavish Krishnakumar in Manchester.
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#ifndef VIEWSURFACETRANSACTION_H
+#define VIEWSURFACETRANSACTION_H
+
+// Qt
+#include <QObject>
+#include <QPointer>
+#include <QRegion>
+#include <QTimer>
+
+namespace NSE {
+class View;
+}
+
+namespace NSE {
+namespace ViewPart {
+
+//! Accumulates the compositor facing state of a view surface (mask/input region,
+//! blur and background contrast) and publishes it once per frame. Updates that
+//! do not change the already published state are dropped.
+class SurfaceTransaction: public QObject
+{
+    Q_OBJECT
+
+public:
+    SurfaceTransaction(NSE::View *parent);
+    virtual ~SurfaceTransaction();
+
+    void setMask(const QRegion &region);
+
+    void setBlurBehind(bool enabled, const QRegion &region = QRegion());
+    void setBackgroundContrast(bool enabled,
+                               qreal contrast = 1,
+                               qreal intensity = 1,
+                               qreal saturation = 1,
+                               const QRegion &region = QRegion());
+
+    //! requests a commit for the next frame, used by clients that prepare their state lazily
+    void scheduleCommit();
+    //! forget the published state, e.g. when the platform surface was recreated
+    void invalidate();
+
+public slots:
+    void commit();
+
+signals:
+    //! emitted just before pending state is published, clients can stage their changes from it
+    void aboutToCommit();
+
+private:
+    struct RegionState {
+        bool enabled{false};
+        uint hash{0};
+        QRegion region;
+    };
+
+    struct ContrastState {
+        RegionState area;
+        qreal contrast{1};
+        qreal intensity{1};
+        qreal saturation{1};
+    };
+
+    static uint regionHash(const QRegion &region);
+    static bool sameRegion(const RegionState &state, bool enabled, const QRegion &region, uint hash);
+
+private:
+    bool m_maskDirty{false};
+    bool m_blurDirty{false};
+    bool m_contrastDirty{false};
+    bool m_committing{false};
+    bool m_scheduled{false};
+
+    //! committed state is invalid until the first publish
+    bool m_hasCommittedMask{false};
+    bool m_hasCommittedBlur{false};
+    bool m_hasCommittedContrast{false};
+
+    RegionState m_pendingMask;
+    RegionState m_committedMask;
+
+    RegionState m_pendingBlur;
+    RegionState m_committedBlur;
+
+    ContrastState m_pendingContrast;
+    ContrastState m_committedContrast;
+
+    QPointer<NSE::View> m_view;
+
+    QTimer m_commitTimer;
+};
+
+}
+}
+
+#endif
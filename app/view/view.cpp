@@ -66,6 +66,7 @@ namespace NSE {
 //! are needed in order for window flags to be set correctly
 View::View(Plasma::Corona *corona, QScreen *targetScreen, bool byPassX11WM)
     : PlasmaQuick::ContainmentView(corona),
+      m_eventsRouter(new ViewPart::EventsRouter(this)),
       m_effects(new ViewPart::Effects(this)),
       m_interface(new ViewPart::ContainmentInterface(this)),
       m_parabolic(new ViewPart::Parabolic(this)),
@@ -1442,6 +1443,11 @@ ViewPart::Effects *View::effects() const
     return m_effects;
 }
 
+ViewPart::EventsRouter *View::eventsRouter() const
+{
+    return m_eventsRouter;
+}
+
 ViewPart::Indicator *View::indicator() const
 {
     return m_indicator;
@@ -1503,12 +1509,10 @@ void View::setInterfacesGraphicObj(NSE::Interfaces *ifaces)
 
 bool View::event(QEvent *e)
 {   
-    QEvent *sunkevent = e;
+    bool sinkableevent{false};
 
     if (!m_inDelete) {
-        emit eventTriggered(e);
-
-        bool sinkableevent{false};
+        m_eventsRouter->route(e);
 
         switch (e->type()) {
         case QEvent::Enter:
@@ -1563,6 +1567,7 @@ bool View::event(QEvent *e)
                 switch (pe->surfaceEventType()) {
                 case QPlatformSurfaceEvent::SurfaceCreated:
                     setupWaylandIntegration();
+                    m_effects->invalidateSurface();
 
                     if (m_shellSurface) {
                         //! immediateSyncGeometry helps avoiding binding loops from containment qml side
@@ -1603,12 +1608,15 @@ bool View::event(QEvent *e)
             break;
         }
 
-        if (sinkableevent && m_sink->isActive()) {
-            sunkevent = m_sink->onEvent(e);
-        }
     }
 
-    return ContainmentView::event(sunkevent);
+    if (sinkableevent && m_sink->isActive()) {
+        return m_sink->sinkEvent(e, [this](QEvent *sunkevent) {
+            return ContainmentView::event(sunkevent);
+        });
+    }
+
+    return ContainmentView::event(e);
 }
 
 void View::releaseConfigView()
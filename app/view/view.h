@@ -13,6 +13,7 @@
 #include "effects.h"
 #include "parabolic.h"
 #include "positioner.h"
+#include "eventsrouter.h"
 #include "eventssink.h"
 #include "visibilitymanager.h"
 #include "indicator/indicator.h"
@@ -237,6 +238,7 @@ public:
     virtual NSE::Data::View data() const;
 
     ViewPart::Effects *effects() const;   
+    ViewPart::EventsRouter *eventsRouter() const;
     ViewPart::ContainmentInterface *extendedInterface() const;
     virtual ViewPart::Indicator *indicator() const;
     ViewPart::Parabolic *parabolic() const;
@@ -286,7 +288,6 @@ protected:
     bool event(QEvent *ev) override;
 
 signals:
-    void eventTriggered(QEvent *ev);
     void mousePressed(const QPoint pos, const int button);
     void mouseReleased(const QPoint pos, const int button);
     void wheelScrolled(const QPoint pos, const QPoint angleDelta, const int buttons);
@@ -442,6 +443,8 @@ private:
     QPointer<PlasmaQuick::ConfigView> m_appletConfigView;
     QPointer<ViewPart::PrimaryConfigView> m_primaryConfigView;
 
+    //! created first, the view parts subscribe to it while they are constructed
+    QPointer<ViewPart::EventsRouter> m_eventsRouter;
     QPointer<ViewPart::Effects> m_effects;
     QPointer<ViewPart::Indicator> m_indicator;
     QPointer<ViewPart::ContainmentInterface> m_interface;
@@ -73,7 +73,9 @@ VisibilityManager::VisibilityManager(PlasmaQuick::ContainmentView *view)
     });
 
     if (m_latteView) {
-        connect(m_latteView, &NSE::View::eventTriggered, this, &VisibilityManager::viewEventManager);
+        m_latteView->eventsRouter()->subscribe(this,
+                                               {QEvent::Enter, QEvent::Leave, QEvent::DragEnter, QEvent::DragLeave, QEvent::Drop},
+                                               [this](QEvent *e) { viewEventManager(e); });
         connect(m_latteView, &NSE::View::behaveAsPlasmaPanelChanged , this, &VisibilityManager::updateKWinEdgesSupport);
         connect(m_latteView, &NSE::View::byPassWMChanged, this, &VisibilityManager::updateKWinEdgesSupport);
 
@@ -42,6 +42,9 @@ AbstractWindowInterface::AbstractWindowInterface(QObject *parent)
 
     rulesConfig = KSharedConfig::openConfig(QStringLiteral("taskmanagerrulesrc"));
 
+    m_appDataResolver = new AppDataResolver(this);
+    connect(m_appDataResolver, &AppDataResolver::appDataResolved, this, &AbstractWindowInterface::appDataResolved);
+
     m_windowWaitingTimer.setInterval(150);
     m_windowWaitingTimer.setSingleShot(true);
 
@@ -348,6 +351,8 @@ void AbstractWindowInterface::unregisterWhitelistedWindow(WindowId wid)
 
 void AbstractWindowInterface::windowRemovedSlot(WindowId wid)
 {
+    m_appDataResolver->forgetWindow(wid);
+
     if (m_plasmaIgnoredWindows.contains(wid)) {
         unregisterPlasmaIgnoredWindow(wid);
     }
@@ -9,6 +9,7 @@
 
 // local
 #include <coretypes.h>
+#include "appdataresolver.h"
 #include "schemecolors.h"
 #include "tasktools.h"
 #include "windowinfowrap.h"
@@ -100,6 +101,8 @@ public:
     virtual QIcon iconFor(WindowId wid) = 0;
     virtual WindowId winIdFor(QString appId, QRect geometry) = 0;
     virtual WindowId winIdFor(QString appId, QString title) = 0;
+    //! the window owned by the given process, the active one is preferred when there are more
+    virtual WindowId winIdFor(quint32 pid) = 0;
     virtual AppData appDataFor(WindowId wid) = 0;
 
     bool isKWinRunning() const;
@@ -146,6 +149,9 @@ signals:
 
     void syndockWindowAdded();
 
+    //! application data of the window became available from the background resolver
+    void appDataResolved(WindowId wid);
+
 protected:
     QString m_currentDesktop;
     QString m_currentActivity;
@@ -170,6 +176,9 @@ protected:
     //! Plasma taskmanager rules ile
     KSharedConfig::Ptr rulesConfig;
 
+    //! memoised application data of windows
+    AppDataResolver *m_appDataResolver{nullptr};
+
     void considerWindowChanged(WindowId wid);
 
     bool isIgnored(const WindowId &wid) const;
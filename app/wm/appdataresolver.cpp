@@ -0,0 +1,120 @@
+/* This file is a part of the Atmo desktop experience's SynDock project for SynOS.
+ * Copyright (C) 2026 Syndromatic Ltd. All rights reserved
+ * Designed by Kavish Krishnakumar in Manchester.
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "appdataresolver.h"
+
+// Qt
+#include <QFileInfo>
+#include <QMetaObject>
+
+// KDE
+#include <KSharedConfig>
+#include <KSycoca>
+
+namespace NSE {
+namespace WindowSystem {
+
+AppDataResolver::AppDataResolver(QObject *parent)
+    : QObject(parent)
+{
+    //! a single background thread, lookups are rare and must not compete with each other
+    m_resolverThread.setMaxThreadCount(1);
+    m_resolverThread.setExpiryTimeout(30000);
+
+    connect(KSycoca::self(), &KSycoca::databaseChanged, this, &AppDataResolver::invalidate);
+}
+
+AppDataResolver::~AppDataResolver()
+{
+    m_resolverThread.clear();
+    m_resolverThread.waitForDone();
+}
+
+QString AppDataResolver::executable(quint32 pid)
+{
+    if (pid == 0) {
+        return QString();
+    }
+
+    //! a single readlink, it distinguishes applications that share the same appId
+    return QFileInfo(QStringLiteral("/proc/%1/exe").arg(pid)).symLinkTarget();
+}
+
+bool AppDataResolver::appData(const WindowId &wid, const QString &appId, quint32 pid, AppData &data)
+{
+    const QString key = appId + QLatin1Char('\n') + executable(pid);
+
+    auto cached = m_cache.constFind(key);
+
+    if (cached != m_cache.constEnd()) {
+        data = cached.value();
+        return true;
+    }
+
+    auto pending = m_pending.find(key);
+
+    if (pending != m_pending.end()) {
+        if (!pending->contains(wid)) {
+            pending->append(wid);
+        }
+
+        return false;
+    }
+
+    m_pending[key] << wid;
+
+    const int generation = m_generation;
+
+    m_resolverThread.start([this, key, appId, pid, generation]() {
+        //! KSharedConfig instances are per thread, the rules file is opened for the resolver thread
+        KSharedConfig::Ptr rulesConfig = KSharedConfig::openConfig(QStringLiteral("taskmanagerrulesrc"));
+        const QUrl url = windowUrlFromMetadata(appId, pid, rulesConfig);
+
+        QMetaObject::invokeMethod(this, [this, key, url, generation]() {
+            onUrlResolved(key, url, generation);
+        }, Qt::QueuedConnection);
+    });
+
+    return false;
+}
+
+void AppDataResolver::onUrlResolved(const QString &key, const QUrl &url, int generation)
+{
+    const QList<WindowId> windows = m_pending.take(key);
+
+    if (generation != m_generation) {
+        //! the service database changed meanwhile, waiting windows must ask again
+        for (const auto &wid : windows) {
+            emit appDataResolved(wid);
+        }
+
+        return;
+    }
+
+    //! icons are created in the gui thread, failed lookups are cached as empty data
+    m_cache[key] = url.isValid() ? appDataFromUrl(url) : AppData();
+
+    for (const auto &wid : windows) {
+        emit appDataResolved(wid);
+    }
+}
+
+void AppDataResolver::forgetWindow(const WindowId &wid)
+{
+    for (auto it = m_pending.begin(); it != m_pending.end(); ++it) {
+        it->removeAll(wid);
+    }
+}
+
+void AppDataResolver::invalidate()
+{
+    ++m_generation;
+    m_cache.clear();
+}
+
+}
+}
@@ -0,0 +1,67 @@
+/* This file is a part of the Atmo desktop experience's SynDock project for SynOS.
+ * Copyright (C) 2026 Syndromatic Ltd. All rights reserved
+ * Designed by Kavish Krishnakumar in Manchester.
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#ifndef APPDATARESOLVER_H
+#define APPDATARESOLVER_H
+
+// local
+#include "tasktools.h"
+#include "windowinfowrap.h"
+
+// Qt
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QThreadPool>
+
+namespace NSE {
+namespace WindowSystem {
+
+//! Memoises the application data of windows. Resolving a window to its application
+//! requires service database queries and /proc reads, so they are executed in a
+//! background thread and their results, including failed ones, are cached by
+//! application id and process executable until the service database changes.
+class AppDataResolver : public QObject
+{
+    Q_OBJECT
+
+public:
+    AppDataResolver(QObject *parent);
+    ~AppDataResolver() override;
+
+    //! returns true and fills data when the application data are already known,
+    //! otherwise they are resolved asynchronously and appDataResolved(wid) is emitted
+    bool appData(const WindowId &wid, const QString &appId, quint32 pid, AppData &data);
+
+    void forgetWindow(const WindowId &wid);
+
+public slots:
+    void invalidate();
+
+signals:
+    void appDataResolved(const WindowId &wid);
+
+private:
+    static QString executable(quint32 pid);
+
+    void onUrlResolved(const QString &key, const QUrl &url, int generation);
+
+private:
+    //! increased on every invalidation, results of older lookups are ignored
+    int m_generation{0};
+
+    QHash<QString, AppData> m_cache;
+    //! windows waiting for a lookup that is running
+    QHash<QString, QList<WindowId>> m_pending;
+
+    QThreadPool m_resolverThread;
+};
+
+}
+}
+
+#endif
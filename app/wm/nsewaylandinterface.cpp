@@ -623,17 +623,15 @@ WindowInfoWrap NSEWaylandInterface::requestInfo(WindowId wid)
 AppData NSEWaylandInterface::appDataFor(WindowId wid)
 {
     auto window = windowFor(wid);
+    AppData data;
 
     if (window) {
-        const AppData &data = appDataFromUrl(windowUrlFromMetadata(window->appId(),
-                                                                   window->pid(), rulesConfig));
-
-        return data;
+        //! when the data are not known yet they are resolved in the background and
+        //! appDataResolved(wid) is emitted afterwards
+        m_appDataResolver->appData(wid, window->appId(), window->pid(), data);
     }
 
-    AppData empty;
-
-    return empty;
+    return data;
 }
 
 KWayland::Client::PlasmaWindow *NSEWaylandInterface::windowFor(WindowId wid)
@@ -682,6 +680,29 @@ WindowId NSEWaylandInterface::winIdFor(QString appId, QString title)
     return (*it)->internalId();
 }
 
+WindowId NSEWaylandInterface::winIdFor(quint32 pid)
+{
+    if (!m_windowManagement || pid == 0) {
+        return WindowId{};
+    }
+
+    PlasmaWindow *active = m_windowManagement->activeWindow();
+
+    if (active && active->isValid() && active->pid() == pid) {
+        return active->internalId();
+    }
+
+    auto it = std::find_if(m_windowManagement->windows().constBegin(), m_windowManagement->windows().constEnd(), [&pid](PlasmaWindow * w) noexcept {
+        return w->isValid() && w->pid() == pid;
+    });
+
+    if (it == m_windowManagement->windows().constEnd()) {
+        return WindowId{};
+    }
+
+    return (*it)->internalId();
+}
+
 WindowId NSEWaylandInterface::winIdFor(QString appId, QRect geometry)
 {
     if (!m_windowManagement) {
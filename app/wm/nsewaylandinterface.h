@@ -76,6 +76,7 @@ public:
     QIcon iconFor(WindowId wid) override;
     WindowId winIdFor(QString appId, QRect geometry) override;
     WindowId winIdFor(QString appId, QString title) override;
+    WindowId winIdFor(quint32 pid) override;
 
     AppData appDataFor(WindowId wid) override;
 
@@ -10,21 +10,112 @@
 #include <config-syndock.h>
 #include "../layouts/importer.h"
 #include "../tools/commontools.h"
+#include "../tools/filewatchrouter.h"
 
 // Qt
 #include <QDebug>
 #include <QDir>
 #include <QFileInfo>
+#include <QHash>
 #include <QLatin1String>
 
 // KDE
 #include <KConfigGroup>
-#include <KDirWatch>
 #include <KSharedConfig>
 
 namespace NSE {
 namespace WindowSystem {
 
+namespace {
+//! process wide memoised lookups, scheme name -> scheme file and scheme file -> scheme name
+QHash<QString, QString> s_schemeFiles;
+QHash<QString, QString> s_schemeNames;
+
+QString lookupSchemeFile(const QString &scheme)
+{
+    if (scheme == QLatin1String("kdeglobals")
+            || (scheme.endsWith("kdeglobals") && QFileInfo(scheme).exists()) ) {
+        // do nothing, accept kdeglobals case
+    } else if (scheme.startsWith("/") && scheme.endsWith("colors") && QFileInfo(scheme).exists()) {
+        return scheme;
+    }
+
+    QString schemePath;
+    QString tempScheme = scheme;
+
+    if (scheme == QLatin1String("kdeglobals")
+            || (scheme.endsWith("kdeglobals") && QFileInfo(scheme).exists()) ) {
+        QString settingsFile = NSE::configPath() + "/kdeglobals";
+
+        bool supportsAutoAccentColor{false}; // introduced on plasma 5.25
+
+        if (QFileInfo(settingsFile).exists()) {
+            KSharedConfigPtr filePtr = KSharedConfig::openConfig(settingsFile);
+            //! the shared config may hold the contents from before the file was modified
+            filePtr->reparseConfiguration();
+            KConfigGroup wmGroup = KConfigGroup(filePtr, "WM");
+            KConfigGroup generalGroup = KConfigGroup(filePtr, "General");
+
+            if (wmGroup.hasKey("activeBackground")) {
+                supportsAutoAccentColor = true;
+            } else {
+                tempScheme = generalGroup.readEntry("ColorScheme", "BreezeLight");
+            }
+        }
+
+        if (supportsAutoAccentColor) {
+            schemePath = NSE::configPath() + "/kdeglobals";
+        } else {
+            schemePath = Layouts::Importer::standardPath("color-schemes/" + tempScheme + ".colors");
+        }
+    } else {
+        schemePath = Layouts::Importer::standardPath("color-schemes/" + tempScheme + ".colors");
+    }
+
+    if (schemePath.isEmpty() || !QFileInfo(schemePath).exists()) {
+        //! remove all whitespaces and "-" from scheme in order to access correctly its file
+        QString schemeNameSimplified = tempScheme.simplified().remove(" ").remove("-");
+
+        schemePath = Layouts::Importer::standardPath("color-schemes/" + schemeNameSimplified + ".colors");
+    }
+
+    if (QFileInfo(schemePath).exists()) {
+        return schemePath;
+    }
+
+    return "";
+}
+
+QString lookupSchemeName(const QString &originalFile)
+{
+    if (originalFile.endsWith("kdeglobals") && QFileInfo(originalFile).exists()) {
+        return "kdeglobals";
+    }
+
+    if (!(originalFile.startsWith("/") && originalFile.endsWith("colors") && QFileInfo(originalFile).exists())) {
+        return "";
+    }
+
+    QString fileNameNoExt =  originalFile;
+
+    int lastSlash = originalFile.lastIndexOf("/");
+
+    if (lastSlash >= 0) {
+        fileNameNoExt.remove(0, lastSlash + 1);
+    }
+
+    if (fileNameNoExt.endsWith(".colors")) {
+        fileNameNoExt.remove(".colors");
+    }
+
+    KSharedConfigPtr filePtr = KSharedConfig::openConfig(originalFile);
+    filePtr->reparseConfiguration();
+    KConfigGroup generalGroup = KConfigGroup(filePtr, "General");
+
+    return generalGroup.readEntry("Name", fileNameNoExt);
+}
+}
+
 SchemeColors::SchemeColors(QObject *parent, QString scheme, bool plasmaTheme) :
     QObject(parent),
     m_basedOnPlasmaTheme(plasmaTheme)
@@ -36,16 +127,8 @@ SchemeColors::SchemeColors(QObject *parent, QString scheme, bool plasmaTheme) :
         m_schemeName = schemeName(pSchemeFile);
 
         //! track scheme file for changes
-        KDirWatch::self()->addFile(m_schemeFile);
-
-        connect(KDirWatch::self(), &KDirWatch::created, this, [ & ](const QString & path) {
-            if (path == m_schemeFile) {
-                updateScheme();
-            }
-        });
-
-        connect(KDirWatch::self(), &KDirWatch::dirty, this, [ & ](const QString & path) {
-            if (path == m_schemeFile) {
+        FileWatchRouter::self()->watchFile(this, m_schemeFile, [&](const QString &, FileWatchRouter::Changes changes) {
+            if (changes & (FileWatchRouter::Dirty | FileWatchRouter::Created)) {
                 updateScheme();
             }
         });
@@ -61,67 +144,67 @@ SchemeColors::~SchemeColors()
 
 QColor SchemeColors::backgroundColor() const
 {
-    return m_activeBackgroundColor;
+    return m_palette.activeBackgroundColor;
 }
 
 QColor SchemeColors::textColor() const
 {
-    return m_activeTextColor;
+    return m_palette.activeTextColor;
 }
 
 QColor SchemeColors::inactiveBackgroundColor() const
 {
-    return m_inactiveBackgroundColor;
+    return m_palette.inactiveBackgroundColor;
 }
 
 QColor SchemeColors::inactiveTextColor() const
 {
-    return m_inactiveTextColor;
+    return m_palette.inactiveTextColor;
 }
 
 QColor SchemeColors::highlightColor() const
 {
-    return m_highlightColor;
+    return m_palette.highlightColor;
 }
 
 QColor SchemeColors::highlightedTextColor() const
 {
-    return m_highlightedTextColor;
+    return m_palette.highlightedTextColor;
 }
 
 QColor SchemeColors::positiveTextColor() const
 {
-    return m_positiveTextColor;
+    return m_palette.positiveTextColor;
 }
 
 QColor SchemeColors::neutralTextColor() const
 {
-    return m_neutralTextColor;
+    return m_palette.neutralTextColor;
 }
 
 QColor SchemeColors::negativeTextColor() const
 {
-    return m_negativeTextColor;
+    return m_palette.negativeTextColor;
 }
 
 QColor SchemeColors::buttonTextColor() const
 {
-    return m_buttonTextColor;
+    return m_palette.buttonTextColor;
 }
 
 QColor SchemeColors::buttonBackgroundColor() const
 {
-    return m_buttonBackgroundColor;
+    return m_palette.buttonBackgroundColor;
 }
 
 QColor SchemeColors::buttonHoverColor() const
 {
-    return m_buttonHoverColor;
+    return m_palette.buttonHoverColor;
 }
 
 QColor SchemeColors::buttonFocusColor() const
 {
-    return m_buttonFocusColor;
+    return m_palette.buttonFocusColor;
 }
 
 QString SchemeColors::schemeName() const
@@ -146,121 +229,109 @@ void SchemeColors::setSchemeFile(QString file)
 
 QString SchemeColors::possibleSchemeFile(QString scheme)
 {
-    if (scheme == QLatin1String("kdeglobals")
-            || (scheme.endsWith("kdeglobals") && QFileInfo(scheme).exists()) ) {
-        // do nothing, accept kdeglobals case
-    } else if (scheme.startsWith("/") && scheme.endsWith("colors") && QFileInfo(scheme).exists()) {
-        return scheme;
-    }
+    auto cached = s_schemeFiles.constFind(scheme);
 
-    QString schemePath;
-    QString tempScheme = scheme;
-
-    if (scheme == QLatin1String("kdeglobals")
-            || (scheme.endsWith("kdeglobals") && QFileInfo(scheme).exists()) ) {
-        QString settingsFile = NSE::configPath() + "/kdeglobals";
-
-        bool supportsAutoAccentColor{false}; // introduced on plasma 5.25
-
-        if (QFileInfo(settingsFile).exists()) {
-            KSharedConfigPtr filePtr = KSharedConfig::openConfig(settingsFile);
-            KConfigGroup wmGroup = KConfigGroup(filePtr, "WM");
-            KConfigGroup generalGroup = KConfigGroup(filePtr, "General");
-
-            if (wmGroup.hasKey("activeBackground")) {
-                supportsAutoAccentColor = true;
-            } else {
-                tempScheme = generalGroup.readEntry("ColorScheme", "BreezeLight");
-            }
-        }
-
-        if (supportsAutoAccentColor) {
-            schemePath = NSE::configPath() + "/kdeglobals";
-        } else {
-            schemePath = Layouts::Importer::standardPath("color-schemes/" + tempScheme + ".colors");
-        }
-    } else {
-        schemePath = Layouts::Importer::standardPath("color-schemes/" + tempScheme + ".colors");
+    if (cached != s_schemeFiles.constEnd()) {
+        return cached.value();
     }
 
-    if (schemePath.isEmpty() || !QFileInfo(schemePath).exists()) {
-        //! remove all whitespaces and "-" from scheme in order to access correctly its file
-        QString schemeNameSimplified = tempScheme.simplified().remove(" ").remove("-");
-
-        schemePath = Layouts::Importer::standardPath("color-schemes/" + schemeNameSimplified + ".colors");
-    }
+    QString file = lookupSchemeFile(scheme);
 
-    if (QFileInfo(schemePath).exists()) {
-        return schemePath;
+    //! schemes that are not found are not memoised, they may be installed afterwards
+    if (!file.isEmpty()) {
+        s_schemeFiles[scheme] = file;
     }
 
-    return "";
+    return file;
 }
 
 QString SchemeColors::schemeName(QString originalFile)
 {
-    if (originalFile.endsWith("kdeglobals") && QFileInfo(originalFile).exists()) {
-        return "kdeglobals";
-    }
+    auto cached = s_schemeNames.constFind(originalFile);
 
-    if (!(originalFile.startsWith("/") && originalFile.endsWith("colors") && QFileInfo(originalFile).exists())) {
-        return "";
+    if (cached != s_schemeNames.constEnd()) {
+        return cached.value();
     }
 
-    QString fileNameNoExt =  originalFile;
+    QString name = lookupSchemeName(originalFile);
 
-    int lastSlash = originalFile.lastIndexOf("/");
-
-    if (lastSlash >= 0) {
-        fileNameNoExt.remove(0, lastSlash + 1);
-    }
-
-    if (fileNameNoExt.endsWith(".colors")) {
-        fileNameNoExt.remove(".colors");
+    if (!name.isEmpty()) {
+        s_schemeNames[originalFile] = name;
     }
 
-    KSharedConfigPtr filePtr = KSharedConfig::openConfig(originalFile);
-    KConfigGroup generalGroup = KConfigGroup(filePtr, "General");
+    return name;
+}
 
-    return generalGroup.readEntry("Name", fileNameNoExt);
+void SchemeColors::invalidateLookups()
+{
+    s_schemeFiles.clear();
+    s_schemeNames.clear();
 }
 
-void SchemeColors::updateScheme()
+SchemeColors::Palette SchemeColors::parsePalette(const QString &file, bool plasmaTheme)
 {
-    if (m_schemeFile.isEmpty() || !QFileInfo(m_schemeFile).exists()) {
-        return;
+    //! parsed palettes are shared by all SchemeColors of the process and are
+    //! reparsed only when the scheme file is modified
+    static QHash<QString, Palette> s_palettes;
+
+    QFileInfo info(file);
+    const QString key = info.canonicalFilePath() + (plasmaTheme ? QStringLiteral("\nplasma") : QString());
+    const QDateTime lastModified = info.lastModified();
+
+    auto cached = s_palettes.constFind(key);
+
+    if (cached != s_palettes.constEnd() && cached->lastModified == lastModified) {
+        return cached.value();
     }
 
-    KSharedConfigPtr filePtr = KSharedConfig::openConfig(m_schemeFile);
+    Palette palette;
+    palette.lastModified = lastModified;
+
+    KSharedConfigPtr filePtr = KSharedConfig::openConfig(file);
+    //! the file was modified since it was last read and KSharedConfig instances are reused
+    filePtr->reparseConfiguration();
     KConfigGroup wmGroup = KConfigGroup(filePtr, "WM");
     KConfigGroup selGroup = KConfigGroup(filePtr, "Colors:Selection");
     //KConfigGroup viewGroup = KConfigGroup(filePtr, "Colors:View");
     KConfigGroup windowGroup = KConfigGroup(filePtr, "Colors:Window");
     KConfigGroup buttonGroup = KConfigGroup(filePtr, "Colors:Button");
 
-    if (!m_basedOnPlasmaTheme) {
-        m_activeBackgroundColor = wmGroup.readEntry("activeBackground", QColor());
-        m_activeTextColor = wmGroup.readEntry("activeForeground", QColor());
-        m_inactiveBackgroundColor = wmGroup.readEntry("inactiveBackground", QColor());
-        m_inactiveTextColor = wmGroup.readEntry("inactiveForeground", QColor());
+    if (!plasmaTheme) {
+        palette.activeBackgroundColor = wmGroup.readEntry("activeBackground", QColor());
+        palette.activeTextColor = wmGroup.readEntry("activeForeground", QColor());
+        palette.inactiveBackgroundColor = wmGroup.readEntry("inactiveBackground", QColor());
+        palette.inactiveTextColor = wmGroup.readEntry("inactiveForeground", QColor());
     } else {
-        m_activeBackgroundColor = windowGroup.readEntry("BackgroundNormal", QColor());
-        m_activeTextColor = windowGroup.readEntry("ForegroundNormal", QColor());
-        m_inactiveBackgroundColor = windowGroup.readEntry("BackgroundAlternate", QColor());
-        m_inactiveTextColor = windowGroup.readEntry("ForegroundInactive", QColor());
+        palette.activeBackgroundColor = windowGroup.readEntry("BackgroundNormal", QColor());
+        palette.activeTextColor = windowGroup.readEntry("ForegroundNormal", QColor());
+        palette.inactiveBackgroundColor = windowGroup.readEntry("BackgroundAlternate", QColor());
+        palette.inactiveTextColor = windowGroup.readEntry("ForegroundInactive", QColor());
     }
 
-    m_highlightColor = selGroup.readEntry("BackgroundNormal", QColor());
-    m_highlightedTextColor = selGroup.readEntry("ForegroundNormal", QColor());
+    palette.highlightColor = selGroup.readEntry("BackgroundNormal", QColor());
+    palette.highlightedTextColor = selGroup.readEntry("ForegroundNormal", QColor());
 
-    m_positiveTextColor = windowGroup.readEntry("ForegroundPositive", QColor());
-    m_neutralTextColor = windowGroup.readEntry("ForegroundNeutral", QColor());;
-    m_negativeTextColor = windowGroup.readEntry("ForegroundNegative", QColor());
+    palette.positiveTextColor = windowGroup.readEntry("ForegroundPositive", QColor());
+    palette.neutralTextColor = windowGroup.readEntry("ForegroundNeutral", QColor());
+    palette.negativeTextColor = windowGroup.readEntry("ForegroundNegative", QColor());
+
+    palette.buttonTextColor = buttonGroup.readEntry("ForegroundNormal", QColor());
+    palette.buttonBackgroundColor = buttonGroup.readEntry("BackgroundNormal", QColor());
+    palette.buttonHoverColor = buttonGroup.readEntry("DecorationHover", QColor());
+    palette.buttonFocusColor = buttonGroup.readEntry("DecorationFocus", QColor());
+
+    s_palettes[key] = palette;
+
+    return palette;
+}
+
+void SchemeColors::updateScheme()
+{
+    if (m_schemeFile.isEmpty() || !QFileInfo(m_schemeFile).exists()) {
+        return;
+    }
 
-    m_buttonTextColor = buttonGroup.readEntry("ForegroundNormal", QColor());
-    m_buttonBackgroundColor = buttonGroup.readEntry("BackgroundNormal", QColor());
-    m_buttonHoverColor = buttonGroup.readEntry("DecorationHover", QColor());
-    m_buttonFocusColor = buttonGroup.readEntry("DecorationFocus", QColor());
+    m_palette = parsePalette(m_schemeFile, m_basedOnPlasmaTheme);
 
     emit colorsChanged();
 }
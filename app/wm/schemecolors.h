@@ -10,6 +10,7 @@
 // Qt
 #include <QObject>
 #include <QColor>
+#include <QDateTime>
 
 namespace NSE {
 namespace WindowSystem {
@@ -62,6 +63,10 @@ public:
     static QString possibleSchemeFile(QString scheme);
     static QString schemeName(QString originalFile);
 
+    //! drops the memoised scheme lookups, must be called when kdeglobals or
+    //! the installed color schemes change
+    static void invalidateLookups();
+
 signals:
     void colorsChanged();
     void schemeFileChanged();
@@ -70,27 +75,36 @@ private slots:
     void updateScheme();
 
 private:
-    bool m_basedOnPlasmaTheme{false};
+    struct Palette {
+        QDateTime lastModified;
 
-    QString m_schemeName;
-    QString m_schemeFile;
+        QColor activeBackgroundColor;
+        QColor activeTextColor;
+
+        QColor inactiveBackgroundColor;
+        QColor inactiveTextColor;
+
+        QColor highlightColor;
+        QColor highlightedTextColor;
+        QColor positiveTextColor;
+        QColor neutralTextColor;
+        QColor negativeTextColor;
 
-    QColor m_activeBackgroundColor;
-    QColor m_activeTextColor;
+        QColor buttonTextColor;
+        QColor buttonBackgroundColor;
+        QColor buttonHoverColor;
+        QColor buttonFocusColor;
+    };
 
-    QColor m_inactiveBackgroundColor;
-    QColor m_inactiveTextColor;
+    static Palette parsePalette(const QString &file, bool plasmaTheme);
 
-    QColor m_highlightColor;
-    QColor m_highlightedTextColor;
-    QColor m_positiveTextColor;
-    QColor m_neutralTextColor;
-    QColor m_negativeTextColor;
+private:
+    bool m_basedOnPlasmaTheme{false};
+
+    QString m_schemeName;
+    QString m_schemeFile;
 
-    QColor m_buttonTextColor;
-    QColor m_buttonBackgroundColor;
-    QColor m_buttonHoverColor;
-    QColor m_buttonFocusColor;
+    Palette m_palette;
 };
 
 }
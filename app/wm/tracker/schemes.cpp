@@ -6,16 +6,18 @@
 #include "schemes.h"
 
 // local
+#include "windowstracker.h"
 #include "../abstractwindowinterface.h"
 #include "../../nsecoronainterface.h"
 #include "../../tools/commontools.h"
+#include "../../tools/filewatchrouter.h"
 
 // Qt
 #include <QDir>
 #include <QLatin1String>
+#include <QStandardPaths>
 
 // KDE
-#include <KDirWatch>
 
 
 namespace NSE {
@@ -42,11 +44,9 @@ void Schemes::init()
 {
     updateDefaultScheme();
 
-    connect(this, &Schemes::colorSchemeChanged, this, [&](WindowId wid) {
-        if (wid == m_wm->activeWindow()) {
-            emit m_wm->activeWindowChanged(wid);
-        }
-    });
+    //! only the views that are coloured from this window need to be informed,
+    //! there is no need to recalculate all windows hints
+    connect(this, &Schemes::colorSchemeChanged, m_wm->windowsTracker(), &Windows::updateWindowScheme);
 
     connect(m_wm, &AbstractWindowInterface::windowRemoved, this, [&](WindowId wid) {
         m_windowScheme.remove(wid);
@@ -55,19 +55,25 @@ void Schemes::init()
     //! track for changing default scheme
     QString kdeSettingsFile = NSE::configPath() + "/kdeglobals";
 
-    KDirWatch::self()->addFile(kdeSettingsFile);
-
-    connect(KDirWatch::self(), &KDirWatch::dirty, this, [ &, kdeSettingsFile](const QString & path) {
-        if (path == kdeSettingsFile) {
+    FileWatchRouter::self()->watchFile(this, kdeSettingsFile, [&](const QString &, FileWatchRouter::Changes changes) {
+        if (changes & (FileWatchRouter::Dirty | FileWatchRouter::Created)) {
+            SchemeColors::invalidateLookups();
             this->updateDefaultScheme();
         }
     });
 
-    connect(KDirWatch::self(), &KDirWatch::created, this, [ &, kdeSettingsFile](const QString & path) {
-        if (path == kdeSettingsFile) {
-            this->updateDefaultScheme();
-        }
-    });
+    //! track installed color schemes in order to refresh the memoised scheme lookups, the local
+    //! schemes override the system ones, removed schemes must stop resolving and the scheme
+    //! names are read from the files
+    const QStringList dataDirs = QStandardPaths::standardLocations(QStandardPaths::GenericDataLocation);
+
+    for (const auto &dataDir : dataDirs) {
+        FileWatchRouter::self()->watchDir(this, dataDir + "/color-schemes", [&](const QString &, FileWatchRouter::Changes changes) {
+            if (changes & (FileWatchRouter::Dirty | FileWatchRouter::Created | FileWatchRouter::Deleted)) {
+                SchemeColors::invalidateLookups();
+            }
+        }, KDirWatch::WatchFiles);
+    }
 }
 
 //! Scheme support for windows
@@ -127,6 +133,7 @@ void Schemes::setColorSchemeForWindow(WindowId wid, QString scheme)
         //! a window that previously had an explicit set scheme now is set back to default scheme
         m_windowScheme.remove(wid);
     } else {
+        //! scheme files are memoised, so windows activations do not access any files
         QString schemeFile = SchemeColors::possibleSchemeFile(scheme);
 
         if (!m_schemes.contains(schemeFile)) {
@@ -134,6 +141,11 @@ void Schemes::setColorSchemeForWindow(WindowId wid, QString scheme)
             m_schemes[schemeFile] = new SchemeColors(this, schemeFile);
         }
 
+        if (m_windowScheme.contains(wid) && m_windowScheme[wid] == schemeFile) {
+            //! the window is already using this scheme
+            return;
+        }
+
         m_windowScheme[wid] = schemeFile;
     }
 
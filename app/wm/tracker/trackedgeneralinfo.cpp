@@ -132,6 +132,16 @@ void TrackedGeneralInfo::setActiveWindowScheme(SchemeColors *scheme)
     m_activeWindowScheme = scheme;
 }
 
+WindowId TrackedGeneralInfo::activeWindowSchemeId() const
+{
+    return m_activeWindowSchemeId;
+}
+
+void TrackedGeneralInfo::setActiveWindowSchemeId(const WindowId &wid)
+{
+    m_activeWindowSchemeId = wid;
+}
+
 AbstractWindowInterface *TrackedGeneralInfo::wm()
 {
     return m_wm;
@@ -56,6 +56,10 @@ public:
     SchemeColors *activeWindowScheme() const;
     void setActiveWindowScheme(SchemeColors *scheme);
 
+    //! the window the active window scheme was taken from
+    WindowId activeWindowSchemeId() const;
+    void setActiveWindowSchemeId(const WindowId &wid);
+
     AbstractWindowInterface *wm();
 
     void setActiveWindow(const WindowId &wid);
@@ -87,6 +91,7 @@ private:
     bool m_isTrackingCurrentActivity{true};
 
     SchemeColors *m_activeWindowScheme{nullptr};
+    WindowId m_activeWindowSchemeId;
 };
 
 }
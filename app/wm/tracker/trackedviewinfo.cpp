@@ -130,6 +130,16 @@ void TrackedViewInfo::setTouchingWindowScheme(SchemeColors *scheme)
     m_touchingWindowScheme = scheme;
 }
 
+WindowId TrackedViewInfo::touchingWindowSchemeId() const
+{
+    return m_touchingWindowSchemeId;
+}
+
+void TrackedViewInfo::setTouchingWindowSchemeId(const WindowId &wid)
+{
+    m_touchingWindowSchemeId = wid;
+}
+
 NSE::View *TrackedViewInfo::view() const
 {
     return m_view;
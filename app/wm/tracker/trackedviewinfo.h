@@ -57,6 +57,10 @@ public:
     SchemeColors *touchingWindowScheme() const;
     void setTouchingWindowScheme(SchemeColors *scheme);
 
+    //! the window the touching window scheme was taken from
+    WindowId touchingWindowSchemeId() const;
+    void setTouchingWindowSchemeId(const WindowId &wid);
+
     NSE::View *view() const;
 
     bool isTracking(const WindowInfoWrap &winfo) const override;
@@ -71,6 +75,7 @@ private:
     QRect m_screenGeometry;
 
     SchemeColors *m_touchingWindowScheme{nullptr};
+    WindowId m_touchingWindowSchemeId;
 
     NSE::View *m_view{nullptr};
 };
@@ -89,6 +89,15 @@ void Windows::init()
         emit windowRemoved(wid);
     });
 
+    connect(m_wm, &AbstractWindowInterface::appDataResolved, this, [&](WindowId wid) {
+        if (!m_windows.contains(wid)) {
+            return;
+        }
+
+        m_delayedApplicationData.removeAll(wid);
+        updateApplicationDataFor(wid);
+    });
+
     connect(m_wm, &AbstractWindowInterface::windowAdded, this, [&](WindowId wid) {
         if (!m_windows.contains(wid)) {
             m_windows.insert(wid, m_wm->requestInfo(wid));
@@ -463,6 +472,16 @@ void Windows::setActiveWindowScheme(NSE::View *view, WindowSystem::SchemeColors
     emit activeWindowSchemeChanged(view);
 }
 
+void Windows::updateActiveWindowScheme(NSE::View *view, const WindowId &wid)
+{
+    if (!m_views.contains(view)) {
+        return;
+    }
+
+    m_views[view]->setActiveWindowSchemeId(wid);
+    setActiveWindowScheme(view, (wid.isNull() ? nullptr : m_wm->schemesTracker()->schemeForWindow(wid)));
+}
+
 SchemeColors *Windows::touchingWindowScheme(NSE::View *view) const
 {
     if (!m_views.contains(view)) {
@@ -482,6 +501,16 @@ void Windows::setTouchingWindowScheme(NSE::View *view, WindowSystem::SchemeColor
     emit touchingWindowSchemeChanged(view);
 }
 
+void Windows::updateTouchingWindowScheme(NSE::View *view, const WindowId &wid)
+{
+    if (!m_views.contains(view)) {
+        return;
+    }
+
+    m_views[view]->setTouchingWindowSchemeId(wid);
+    setTouchingWindowScheme(view, (wid.isNull() ? nullptr : m_wm->schemesTracker()->schemeForWindow(wid)));
+}
+
 LastActiveWindow *Windows::lastActiveWindow(NSE::View *view)
 {
     if (!m_views.contains(view)) {
@@ -577,6 +606,16 @@ void Windows::setActiveWindowScheme(NSE::Layout::GenericLayout *layout, WindowSy
     emit activeWindowSchemeChangedForLayout(layout);
 }
 
+void Windows::updateActiveWindowScheme(NSE::Layout::GenericLayout *layout, const WindowId &wid)
+{
+    if (!m_layouts.contains(layout)) {
+        return;
+    }
+
+    m_layouts[layout]->setActiveWindowSchemeId(wid);
+    setActiveWindowScheme(layout, (wid.isNull() ? nullptr : m_wm->schemesTracker()->schemeForWindow(wid)));
+}
+
 LastActiveWindow *Windows::lastActiveWindow(NSE::Layout::GenericLayout *layout)
 {
     if (!m_layouts.contains(layout)) {
@@ -645,28 +684,54 @@ void Windows::updateApplicationData()
 {
     if (m_delayedApplicationData.count() > 0) {
         for(int i=0; i<m_delayedApplicationData.count(); ++i) {
-            auto wid = m_delayedApplicationData[i];
+            updateApplicationDataFor(m_delayedApplicationData[i]);
+        }
+    }
+
+    m_delayedApplicationData.clear();
+}
 
-            if (m_windows.contains(wid)) {
-                AppData data = m_wm->appDataFor(wid);
+void Windows::updateApplicationDataFor(const WindowId &wid)
+{
+    if (!m_windows.contains(wid)) {
+        return;
+    }
 
-                QIcon icon = data.icon;
+    AppData data = m_wm->appDataFor(wid);
 
-                if (icon.isNull()) {
-                    icon = m_wm->iconFor(wid);
-                }
+    QIcon icon = data.icon;
 
-                m_windows[wid].setIcon(icon);
-                m_windows[wid].setAppName(data.name);
+    if (icon.isNull()) {
+        icon = m_wm->iconFor(wid);
+    }
 
-                m_initializedApplicationData.append(wid);
+    m_windows[wid].setIcon(icon);
+    m_windows[wid].setAppName(data.name);
 
-                emit applicationDataChanged(wid);
-            }
+    if (!m_initializedApplicationData.contains(wid)) {
+        m_initializedApplicationData.append(wid);
+    }
+
+    emit applicationDataChanged(wid);
+}
+
+void Windows::updateWindowScheme(const WindowId &wid)
+{
+    for (auto it = m_views.constBegin(); it != m_views.constEnd(); ++it) {
+        if (it.value()->activeWindowSchemeId() == wid) {
+            setActiveWindowScheme(it.key(), m_wm->schemesTracker()->schemeForWindow(wid));
+        }
+
+        if (it.value()->touchingWindowSchemeId() == wid) {
+            setTouchingWindowScheme(it.key(), m_wm->schemesTracker()->schemeForWindow(wid));
         }
     }
 
-    m_delayedApplicationData.clear();
+    for (auto it = m_layouts.constBegin(); it != m_layouts.constEnd(); ++it) {
+        if (it.value()->activeWindowSchemeId() == wid) {
+            setActiveWindowScheme(it.key(), m_wm->schemesTracker()->schemeForWindow(wid));
+        }
+    }
 }
 
 WindowInfoWrap Windows::infoFor(const WindowId &wid) const
@@ -1043,20 +1108,20 @@ void Windows::updateHints(NSE::View *view)
     setExistsWindowTouchingEdge(view, (foundActiveEdgeTouchInCurScreen || foundTouchEdgeInCurScreen));
 
     //! update colour schemes for active and touching windows
-    setActiveWindowScheme(view, (foundActiveInCurScreen ? m_wm->schemesTracker()->schemeForWindow(activeWinId) : nullptr));
+    updateActiveWindowScheme(view, (foundActiveInCurScreen ? activeWinId : WindowId()));
 
     if (foundActiveTouchInCurScreen) {
-        setTouchingWindowScheme(view, m_wm->schemesTracker()->schemeForWindow(activeTouchWinId));
+        updateTouchingWindowScheme(view, activeTouchWinId);
     } else if (foundActiveEdgeTouchInCurScreen) {
-        setTouchingWindowScheme(view, m_wm->schemesTracker()->schemeForWindow(activeTouchEdgeWinId));
+        updateTouchingWindowScheme(view, activeTouchEdgeWinId);
     } else if (foundMaximizedInCurScreen) {
-        setTouchingWindowScheme(view, m_wm->schemesTracker()->schemeForWindow(maxWinId));
+        updateTouchingWindowScheme(view, maxWinId);
     } else if (foundTouchInCurScreen) {
-        setTouchingWindowScheme(view, m_wm->schemesTracker()->schemeForWindow(touchWinId));
+        updateTouchingWindowScheme(view, touchWinId);
     } else if (foundTouchEdgeInCurScreen) {
-        setTouchingWindowScheme(view, m_wm->schemesTracker()->schemeForWindow(touchEdgeWinId));
+        updateTouchingWindowScheme(view, touchEdgeWinId);
     } else {
-        setTouchingWindowScheme(view, nullptr);
+        updateTouchingWindowScheme(view, WindowId());
     }
 
     //! update LastActiveWindow
@@ -1143,7 +1208,7 @@ void Windows::updateHints(NSE::Layout::GenericLayout *layout) {
     setExistsWindowMaximized(layout, foundActiveMaximized || foundMaximized);
 
     //! update colour schemes for active and touching windows
-    setActiveWindowScheme(layout, (foundActive ? m_wm->schemesTracker()->schemeForWindow(activeWinId) : nullptr));
+    updateActiveWindowScheme(layout, (foundActive ? activeWinId : WindowId()));
 
     //! update LastActiveWindow
     if (foundActive) {
@@ -80,6 +80,10 @@ public:
 
     AbstractWindowInterface *wm();
 
+public slots:
+    //! reassigns the colour schemes of views and layouts that are coloured from this window
+    void updateWindowScheme(const WindowId &wid);
+
 signals:
     //! Views
     void enabledChanged(const NSE::View *view);
@@ -117,6 +121,7 @@ private slots:
     void addRelevantLayout(NSE::View *view);
 
     void updateApplicationData();
+    void updateApplicationDataFor(const WindowId &wid);
     void updateRelevantLayouts();
     void updateExtraViewHints();
 
@@ -143,12 +148,15 @@ private:
     void setIsTouchingBusyVerticalView(NSE::View *view, bool viewTouching);
     void setActiveWindowScheme(NSE::View *view, WindowSystem::SchemeColors *scheme);
     void setTouchingWindowScheme(NSE::View *view, WindowSystem::SchemeColors *scheme);
+    void updateActiveWindowScheme(NSE::View *view, const WindowId &wid);
+    void updateTouchingWindowScheme(NSE::View *view, const WindowId &wid);
 
     //! Layouts
     void setActiveWindowMaximized(NSE::Layout::GenericLayout *layout, bool activeMaximized);
     void setExistsWindowActive(NSE::Layout::GenericLayout *layout, bool windowActive);
     void setExistsWindowMaximized(NSE::Layout::GenericLayout *layout, bool windowMaximized);
     void setActiveWindowScheme(NSE::Layout::GenericLayout *layout, WindowSystem::SchemeColors *scheme);
+    void updateActiveWindowScheme(NSE::Layout::GenericLayout *layout, const WindowId &wid);
 
     //! Windows
     bool intersects(NSE::View *view, const WindowInfoWrap &winfo);
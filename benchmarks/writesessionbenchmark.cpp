@@ -0,0 +1,157 @@
+/* This file is a part of the Atmo desktop experience's SynDock project for SynOS.
+ * Copyright (C) 2026 Syndromatic Ltd. All rights reserved
+ * Designed by Kavish Krishnakumar in Manchester.
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+//! Compares the disk writes of copying containments into a layout file one by one,
+//! syncing after each copy as layouts were written before, against a single
+//! WriteSession commit. Every KConfig save goes through QSaveFile, which syncs the
+//! new file before renaming it over the original one, so each sync is counted
+//! together with the size of the file it made durable.
+
+#include "writesession.h"
+
+// Qt
+#include <QCoreApplication>
+#include <QDir>
+#include <QTemporaryDir>
+#include <QTextStream>
+
+// KDE
+#include <KConfigGroup>
+#include <KSharedConfig>
+
+// C++
+#include <functional>
+
+// C
+#include <dlfcn.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+int s_syncs{0};
+qint64 s_bytesWritten{0};
+
+void countSync(int fd)
+{
+    struct stat info;
+
+    ++s_syncs;
+
+    if (fstat(fd, &info) == 0) {
+        s_bytesWritten += info.st_size;
+    }
+}
+
+struct Result {
+    int syncs{0};
+    qint64 bytesWritten{0};
+};
+
+Result measure(const std::function<void()> &run)
+{
+    s_syncs = 0;
+    s_bytesWritten = 0;
+
+    run();
+
+    return Result{s_syncs, s_bytesWritten};
+}
+
+//! containments with a few applets each, close to what docks store in their layout files
+void fillSource(const KSharedConfigPtr &source, int containmentsCount)
+{
+    const int APPLETSPERCONTAINMENT{8};
+
+    KConfigGroup containments(source, QStringLiteral("Containments"));
+
+    for (int i=1; i<=containmentsCount; ++i) {
+        const int containmentId = i * 100;
+        KConfigGroup containment = containments.group(QString::number(containmentId));
+        containment.writeEntry("plugin", "org.kde.syndock.containment");
+        containment.writeEntry("formfactor", 2);
+        containment.writeEntry("location", 4);
+        containment.writeEntry("lastScreen", 0);
+        containment.writeEntry("layoutId", "benchmark");
+        containment.group(QStringLiteral("General")).writeEntry("appletOrder", QStringLiteral("1;2;3;4;5;6;7;8"));
+
+        for (int j=1; j<=APPLETSPERCONTAINMENT; ++j) {
+            KConfigGroup applet = containment.group(QStringLiteral("Applets")).group(QString::number(containmentId + j));
+            applet.writeEntry("immutability", 1);
+            applet.writeEntry("plugin", QStringLiteral("org.kde.plasma.benchmark%1").arg(j));
+            applet.group(QStringLiteral("Configuration")).group(QStringLiteral("General")).writeEntry("launchers", QStringLiteral("applications:org.kde.dolphin.desktop,applications:org.kde.konsole.desktop"));
+        }
+    }
+}
+
+}
+
+extern "C" int fsync(int fd)
+{
+    static auto next = reinterpret_cast<int (*)(int)>(dlsym(RTLD_NEXT, "fsync"));
+    countSync(fd);
+    return next(fd);
+}
+
+extern "C" int fdatasync(int fd)
+{
+    static auto next = reinterpret_cast<int (*)(int)>(dlsym(RTLD_NEXT, "fdatasync"));
+    countSync(fd);
+    return next(fd);
+}
+
+int main(int argc, char **argv)
+{
+    QCoreApplication app(argc, argv);
+    QTextStream out(stdout);
+
+    QTemporaryDir dir;
+
+    if (!dir.isValid()) {
+        out << "temporary directory could not be created" << Qt::endl;
+        return 1;
+    }
+
+    out << "containments | per containment syncs | bytes | session syncs | bytes" << Qt::endl;
+
+    for (const int count : {5, 10, 25, 50, 100}) {
+        const QString sourcePath = dir.filePath(QStringLiteral("source%1.latterc").arg(count));
+        KSharedConfigPtr source = KSharedConfig::openConfig(sourcePath, KConfig::SimpleConfig);
+        fillSource(source, count);
+        source->sync();
+
+        const QStringList ids = KConfigGroup(source, QStringLiteral("Containments")).groupList();
+
+        const Result perContainment = measure([&]() {
+            KSharedConfigPtr file = KSharedConfig::openConfig(dir.filePath(QStringLiteral("single%1.latterc").arg(count)), KConfig::SimpleConfig);
+            KConfigGroup containments(file, QStringLiteral("Containments"));
+
+            for (const auto &id : ids) {
+                KConfigGroup destination = containments.group(id);
+                KConfigGroup(source, QStringLiteral("Containments")).group(id).copyTo(&destination);
+                destination.writeEntry("layoutId", "");
+                file->sync();
+            }
+        });
+
+        const Result session = measure([&]() {
+            NSE::Layouts::WriteSession writeSession(dir.filePath(QStringLiteral("session%1.latterc").arg(count)));
+
+            for (const auto &id : ids) {
+                writeSession.copyContainment(KConfigGroup(source, QStringLiteral("Containments")).group(id), id);
+            }
+
+            writeSession.commit();
+        });
+
+        out << count << " | "
+            << perContainment.syncs << " | " << perContainment.bytesWritten << " | "
+            << session.syncs << " | " << session.bytesWritten << Qt::endl;
+    }
+
+    return 0;
+}
@@ -66,38 +66,62 @@ Item{
 
     property bool updateIsEnabled: autosize.inCalculatedIconSize && !inSlidingIn && !inSlidingOut && !inRelocationHiding
 
-    Connections{
-        target: background.totals
-        onVisualLengthChanged: updateMaskArea();
-        onVisualThicknessChanged: updateMaskArea();
+    //! local geometry, input mask and effects area are derived natively from these metrics
+    //! and the background geometry, they are updated synchronously when any of them changes
+    readonly property QtObject surfaceGeometry: dockView && dockView.effects ? dockView.effects.geometry : null
+
+    Binding {
+        target: manager.surfaceGeometry
+        property: "thickness"
+        value: metrics.totals.thickness
     }
 
-    Connections{
-        target: background.shadows
-        onHeadThicknessChanged: updateMaskArea();
+    Binding {
+        target: manager.surfaceGeometry
+        property: "hiddenThickness"
+        value: metrics.mask.thickness.hidden
     }
 
-    Connections{
-        target: dockView ? dockView : null
-        onXChanged: updateMaskArea();
-        onYChanged: updateMaskArea()
-        onWidthChanged: updateMaskArea();
-        onHeightChanged: updateMaskArea();
+    Binding {
+        target: manager.surfaceGeometry
+        property: "zoomedThickness"
+        value: metrics.mask.thickness.zoomedForItems
     }
 
-    Connections{
-        target: animations.needBothAxis
-        onCountChanged: updateMaskArea();
+    Binding {
+        target: manager.surfaceGeometry
+        property: "screenEdgeMargin"
+        value: metrics.mask.screenEdge
     }
 
-    Connections{
-        target: animations.needLength
-        onCountChanged: updateMaskArea();
+    Binding {
+        target: manager.surfaceGeometry
+        property: "floatingGapMargin"
+        value: metrics.margins.screenEdge
     }
 
-    Connections{
-        target: animations.needThickness
-        onCountChanged: updateMaskArea();
+    Binding {
+        target: manager.surfaceGeometry
+        property: "animated"
+        value: animations.needBothAxis.count > 0
+    }
+
+    Binding {
+        target: manager.surfaceGeometry
+        property: "normalState"
+        value: manager.inNormalState
+    }
+
+    Binding {
+        target: manager.surfaceGeometry
+        property: "updateEnabled"
+        value: manager.updateIsEnabled
+    }
+
+    Binding {
+        target: manager.surfaceGeometry
+        property: "floatingGapInputDisabled"
+        value: root.hasFloatingGapInputEventsDisabled
     }
 
     Connections{
@@ -109,11 +133,6 @@ Item{
         }
     }
 
-    Connections {
-        target: metrics.mask.thickness
-        onMaxZoomedChanged: updateMaskArea()
-    }
-
     Connections {
         target: root.myView
         onInRelocationAnimationChanged: {
@@ -123,43 +142,19 @@ Item{
         }
     }
 
-    Connections {
-        target: dockView ? dockView.effects : null
-        onRectChanged: manager.updateMaskArea()
-    }
-
     Connections{
         target: themeExtended ? themeExtended : null
         onThemeChanged: dockView.effects.forceMaskRedraw();
     }
 
-    Connections {
-        target: LatteCore.WindowSystem
-        onCompositingActiveChanged: {
-            manager.updateMaskArea();
-        }
-    }
-
     onIsFloatingInClientSideChanged: updateMaskArea();
 
-    onInNormalStateChanged: {
-        if (inNormalState) {
-            updateMaskArea();
-        }
-    }
-
     onInSlidingInChanged: {
         if (dockView && !inSlidingIn && dockView.positioner.inRelocationShowing) {
             dockView.positioner.inRelocationShowing = false;
         }
     }
 
-    onUpdateIsEnabledChanged: {
-        if (updateIsEnabled) {
-            updateMaskArea();
-        }
-    }
-
     function slotContainsMouseChanged() {
         if(dockView.visibility.containsMouse && dockView.visibility.mode !== LatteCore.Types.SidebarOnDemand) {
             updateMaskArea();
@@ -252,154 +247,14 @@ Item{
     }
 
     ///test maskArea
+    //! forces an update of the natively derived areas for the cases that
+    //! are not described from the published metrics
     function updateMaskArea() {
-        if (!dockView || !root.viewIsAvailable) {
+        if (!dockView || !root.viewIsAvailable || !surfaceGeometry) {
             return;
         }
 
-        var localX = 0;
-        var localY = 0;
-
-        // debug maskArea criteria
-        if (debug.maskEnabled) {
-            console.log(animations.needBothAxis.count + ", " + animations.needLength.count + ", " +
-                        animations.needThickness.count + ", " + dockView.visibility.isHidden);
-        }
-
-        //console.log("reached updating geometry ::: "+dock.maskArea);
-
-
-        if (!dockView.visibility.isHidden && updateIsEnabled && inNormalState) {
-            //! Important: Local Geometry must not be updated when view ISHIDDEN
-            //! because it breaks Dodge(s) modes in such case
-
-            var localGeometry = Qt.rect(0, 0, root.width, root.height);
-
-            //the shadows size must be removed from the maskArea
-            //before updating the localDockGeometry
-            if (!dockView.behaveAsPlasmaPanel) {
-                var cleanThickness = metrics.totals.thickness;
-                var edgeMargin = metrics.mask.screenEdge;
-
-                if (plasmoid.location === PlasmaCore.Types.TopEdge) {
-                    localGeometry.x = dockView.effects.rect.x; // from effects area
-                    localGeometry.width = dockView.effects.rect.width; // from effects area
-
-                    localGeometry.y = edgeMargin;
-                    localGeometry.height = cleanThickness;
-                } else if (plasmoid.location === PlasmaCore.Types.BottomEdge) {
-                    localGeometry.x = dockView.effects.rect.x; // from effects area
-                    localGeometry.width = dockView.effects.rect.width; // from effects area
-
-                    localGeometry.y = root.height - cleanThickness - edgeMargin;
-                    localGeometry.height = cleanThickness;
-                } else if (plasmoid.location === PlasmaCore.Types.LeftEdge) {
-                    localGeometry.y = dockView.effects.rect.y; // from effects area
-                    localGeometry.height = dockView.effects.rect.height; // from effects area
-
-                    localGeometry.x = edgeMargin;
-                    localGeometry.width = cleanThickness;
-                } else if (plasmoid.location === PlasmaCore.Types.RightEdge) {
-                    localGeometry.y = dockView.effects.rect.y; // from effects area
-                    localGeometry.height = dockView.effects.rect.height; // from effects area
-
-                    localGeometry.x = root.width - cleanThickness - edgeMargin;
-                    localGeometry.width = cleanThickness;
-                }
-
-                //set the boundaries for dockView local geometry
-                //qBound = qMax(min, qMin(value, max)).
-
-                localGeometry.x = Math.max(0, Math.min(localGeometry.x, dockView.width));
-                localGeometry.y = Math.max(0, Math.min(localGeometry.y, dockView.height));
-                localGeometry.width = Math.min(localGeometry.width, dockView.width);
-                localGeometry.height = Math.min(localGeometry.height, dockView.height);
-            }
-
-            //console.log("update geometry ::: "+localGeometry);
-            dockView.localGeometry = localGeometry;
-        }
-
-        //! Input Mask
-        if (updateIsEnabled) {
-            updateInputGeometry();
-        }
-    }
-
-    function updateInputGeometry() {
-        // VisibilityManager.qml tries to workaround faulty onEntered() signals from ParabolicMouseArea
-        // by specifying inputThickness when ParabolicEffect is applied. (inputThickness->animated scenario)
-        var animated = (animations.needBothAxis.count>0);
-
-        if (!LatteCore.WindowSystem.compositingActive || dockView.behaveAsPlasmaPanel) {
-            //! clear input mask
-            dockView.effects.inputMask = Qt.rect(0, 0, -1, -1);
-        } else {
-            var floatingInternalGapAcceptsInput = behaveAsDockWithMask && floatingInternalGapIsForced;
-            var inputThickness;
-
-            if (dockView.visibility.isHidden) {
-                inputThickness = metrics.mask.thickness.hidden;
-            } else if (root.hasFloatingGapInputEventsDisabled) {
-                inputThickness = animated ? metrics.mask.thickness.zoomedForItems - metrics.margins.screenEdge : metrics.totals.thickness;
-            } else {
-                inputThickness = animated ? metrics.mask.thickness.zoomedForItems : metrics.mask.screenEdge + metrics.totals.thickness;
-            }
-
-            var subtractedScreenEdge = root.hasFloatingGapInputEventsDisabled && !dockView.visibility.isHidden ? metrics.mask.screenEdge : 0;
-
-            var inputGeometry = Qt.rect(0, 0, root.width, root.height);
-
-            //!use view.localGeometry for length properties
-            if (plasmoid.location === PlasmaCore.Types.TopEdge) {
-                if (!animated) {
-                    inputGeometry.x = dockView.localGeometry.x;
-                    inputGeometry.width = dockView.localGeometry.width;
-                }
-
-                inputGeometry.y = subtractedScreenEdge;
-                inputGeometry.height = inputThickness;
-            } else if (plasmoid.location === PlasmaCore.Types.BottomEdge) {
-                if (!animated) {
-                    inputGeometry.x = dockView.localGeometry.x;
-                    inputGeometry.width = dockView.localGeometry.width;
-                }
-
-                inputGeometry.y = root.height - inputThickness - subtractedScreenEdge;
-                inputGeometry.height = inputThickness;
-            } else if (plasmoid.location === PlasmaCore.Types.LeftEdge) {
-                if (!animated) {
-                    inputGeometry.y = dockView.localGeometry.y;
-                    inputGeometry.height = dockView.localGeometry.height;
-                }
-
-                inputGeometry.x = subtractedScreenEdge;
-                inputGeometry.width = inputThickness;
-            } else if (plasmoid.location === PlasmaCore.Types.RightEdge) {
-                if (!animated) {
-                    inputGeometry.y = dockView.localGeometry.y;
-                    inputGeometry.height = dockView.localGeometry.height;
-                }
-
-                inputGeometry.x = root.width - inputThickness - subtractedScreenEdge;
-                inputGeometry.width = inputThickness;
-            }
-
-            //set the boundaries for dockView local geometry
-            //qBound = qMax(min, qMin(value, max)).
-
-            inputGeometry.x = Math.max(0, Math.min(inputGeometry.x, dockView.width));
-            inputGeometry.y = Math.max(0, Math.min(inputGeometry.y, dockView.height));
-            inputGeometry.width = Math.min(inputGeometry.width, dockView.width);
-            inputGeometry.height = Math.min(inputGeometry.height, dockView.height);
-
-            if (dockView.visibility.isSidebar && dockView.visibility.isHidden) {
-                //! this way we make sure than no input is accepted anywhere
-                inputGeometry = Qt.rect(-1, -1, 1, 1);
-            }
-
-            dockView.effects.inputMask = inputGeometry;
-        }
+        surfaceGeometry.update();
     }
 
     Loader{
@@ -477,16 +332,12 @@ Item{
 
         onStopped: {
             //! Trying to move the ending part of the signals at the end of editing animation
-            if (!manager.inRelocationHiding) {
-                manager.updateMaskArea();
-            } else {
-                if (!root.editMode) {
-                    manager.sendSlidingOutAnimationEnded();
-                }
+            if (manager.inRelocationHiding && !root.editMode) {
+                manager.sendSlidingOutAnimationEnded();
             }
 
             dockView.visibility.slideOutFinished();
-            manager.updateInputGeometry();
+            manager.updateMaskArea();
 
             if (root.inStartup) {
                 //! when view is first created slide-outs when that animation ends then
@@ -528,7 +379,7 @@ Item{
 
         onStarted: {
             dockView.visibility.show();
-            manager.updateInputGeometry();
+            manager.updateMaskArea();
 
             if (debug.maskEnabled) {
                 console.log("showing animation started...");
@@ -23,6 +23,10 @@ Ability.IndicatorsPrivate {
 
     indicatorComponent: view && view.indicator ? view.indicator.component : null
 
+    //! the built-in indicator style is drawn for all items from a single native renderer
+    property Item renderer: null
+    nativeRenderer: renderer && isEnabled && type === "org.kde.syndock.default" ? renderer : null
+
     info {
         enabledForApplets: indicatorLevel.isLoaded && indicatorLevel.item.hasOwnProperty("enabledForApplets")
                            && indicatorLevel.item.enabledForApplets
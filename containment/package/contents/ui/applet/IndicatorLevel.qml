@@ -43,6 +43,7 @@ AbilityItem.IndicatorLevel {
         }
     }
 
+    nativeRenderingEnabled: true
     level.isDrawn: !appletItem.isSeparator
                    && !appletItem.isMarginsAreaSeparator
                    && !appletItem.isHidden
@@ -6,8 +6,7 @@
 import QtQuick
 
 import org.kde.syndock.abilities.definition 0.1 as AbilityDefinition
-
-import "../../../code/AppletIdentifier.js" as AppletIdentifier
+import org.kde.syndock.private.containment 0.1 as LatteContainment
 
 Item{
     id: mainCommunicator
@@ -31,11 +30,11 @@ Item{
     property bool inStartup: true
 
     property Item appletRootItem: appletDiscoveredRootItem ? appletDiscoveredRootItem : appletDefaultRootItem
-    property Item appletDiscoveredRootItem: null
+    property Item appletDiscoveredRootItem: appletIdentifier.rootItem
     property Item appletDefaultRootItem: applet && applet.children && applet.children.length>0 ? applet.children[0] : null
 
-    property Item appletIconItem: null //first applet's IconItem to be used by Latte
-    property Item appletImageItem: null //first applet's ImageItem to be used by Latte
+    property Item appletIconItem: appletIdentifier.iconItem //first applet's IconItem to be used by Latte
+    property Item appletImageItem: appletIdentifier.imageItem //first applet's ImageItem to be used by Latte
     //! END OF PROPERTIES
 
     //! BEGIN OF PUBLIC PROPERTIES SET THROUGH LATTEBRIDGE.ACTIONS   
@@ -54,21 +53,23 @@ Item{
     readonly property Item bridge: bridgeLoader.active ? bridgeLoader.item : null
     //! END OF ABILITIES SUPPORT
 
-    //! BEGIN OF FUNCTIONS
-
-    function reconsiderAppletIconItem() {
-        AppletIdentifier.reconsiderAppletIconItem();
+    //! BEGIN OF IDENTIFIERS
+    //! finds the applet root and main icon items, it follows the applet items tree
+    //! by itself and stops when the applet identifies itself through latte bridge
+    LatteContainment.AppletIdentifier {
+        id: appletIdentifier
+        active: !mainCommunicator.indexerIsSupported
+        applet: appletItem.applet
+        pluginName: appletItem.applet ? appletItem.applet.pluginName : ""
+        originalAppletBehavior: appletItem.originalAppletBehavior
     }
-
-    //! END OF FUNCTIONS
+    //! END OF IDENTIFIERS
 
     //! BEGIN OF CONNECTIONS
     Connections{
         target: appletItem
         onAppletChanged: {
             if (applet) {
-                AppletIdentifier.checkAndUpdateAppletRootItem();
-                AppletIdentifier.reconsiderAppletIconItem();
                 overlayInitTimer.start();
             }
         }
@@ -90,8 +91,6 @@ Item{
         id: overlayInitTimer
         interval: 1000
         onTriggered: {
-            AppletIdentifier.checkAndUpdateAppletRootItem();
-            AppletIdentifier.reconsiderAppletIconItem();
             mainCommunicator.inStartup = false;
 
             if (appletItem.debug.timersEnabled) {
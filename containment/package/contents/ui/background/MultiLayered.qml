@@ -315,10 +315,6 @@ BackgroundProperties{
         }
     }
 
-    onXChanged: solidBackground.updateEffectsArea();
-    onYChanged: solidBackground.updateEffectsArea();
-    onScreenEdgeMarginChanged: solidBackground.updateEffectsArea();
-
     //! Layer 1: Shadows that are drawn around the background but always inside the View window (these are internal drawn shadows).
     //!          When the container has chosen external shadows (these are shadows that are drawn out of the View window from the compositor)
     //!          in such case the internal drawn shadows are NOT drawn at all.
@@ -406,23 +402,19 @@ BackgroundProperties{
         //! instantly otherwise the transition is not smooth
         readonly property bool paintInstantly: (root.hasExpandedApplet && root.plasmaBackgroundForPopups && !customRadiusIsEnabled)
 
-        property rect efGeometry: Qt.rect(-1,-1,0,0)
-
         property int paddingsWidth: margins.left+margins.right
         property int paddingsHeight: margins.top + margins.bottom
 
-        onWidthChanged: updateEffectsArea();
-        onHeightChanged: updateEffectsArea();
         onImagePathChanged: solidBackground.adjustPrefix();
 
 
-        Component.onCompleted: {
-            root.updateEffectsArea.connect(updateEffectsArea);
-            adjustPrefix();
-        }
+        Component.onCompleted: adjustPrefix();
 
-        Component.onDestruction: {
-            root.updateEffectsArea.disconnect(updateEffectsArea);
+        //! the effects area is derived natively from this item geometry
+        Binding {
+            target: dockView && dockView.effects ? dockView.effects.geometry : null
+            property: "backgroundItem"
+            value: solidBackground
         }
 
         //! Fix for FrameSvgItem QML version not updating its margins after a theme change
@@ -434,71 +426,14 @@ BackgroundProperties{
                 solidBackground.adjustPrefix();
                 plasmoid.configuration.panelShadows = !plasmoid.configuration.panelShadows;
                 plasmoid.configuration.panelShadows = !plasmoid.configuration.panelShadows;
-                updateEffectsArea();
             }
         }
 
-        Connections {
-            target: dockView ? dockView.visibility : null
-            onIsHiddenChanged: solidBackground.updateEffectsArea();
-        }
-
-
         Connections{
             target: plasmoid
             onLocationChanged: solidBackground.adjustPrefix();
         }
 
-        function updateEffectsArea() {
-            if (!updateEffectsAreaTimer.running) {
-               // invUpdateEffectsArea(); // disabled in order to force Timer at all cases
-                updateEffectsAreaTimer.start();
-            }
-        }
-
-        function invUpdateEffectsArea(){
-            if (!dockView)
-                return;
-
-            if (!LatteCore.WindowSystem.compositingActive) {
-                //! NOCOMPOSITING mode is a special case and Effects Area is also used for
-                //! different calculations for View::mask()
-                var rootGeometry = mapToItem(root, 0, 0);
-                efGeometry.x = rootGeometry.x;
-                efGeometry.y = rootGeometry.y;
-                efGeometry.width = width;
-                efGeometry.height = height;
-            } else {
-                if (dockView.visibility.isHidden) {
-                    //! valid hide mask
-                    efGeometry.x = -1;
-                    efGeometry.y = -1;
-                    efGeometry.width = 1;
-                    efGeometry.height = 1;
-                } else {
-                    if (!root.behaveAsPlasmaPanel) {
-                        var rootGeometry = mapToItem(root, 0, 0);
-                        efGeometry.x = rootGeometry.x;
-                        efGeometry.y = rootGeometry.y;
-                    } else {
-                        efGeometry.x = 0;
-                        efGeometry.y = 0;
-                    }
-
-                    efGeometry.width = width;
-                    efGeometry.height = height;
-                }
-            }
-
-            dockView.effects.rect = efGeometry;
-        }
-
-        Timer {
-            id: updateEffectsAreaTimer
-            interval: 11 //! 90Hz or 90calls/sec
-            onTriggered: solidBackground.invUpdateEffectsArea();
-        }
-
         onRepaintNeeded: {
             if (root.behaveAsPlasmaPanel)
                 adjustPrefix();
@@ -249,9 +249,6 @@ Item{
         }
     }
 
-    onXChanged: root.updateEffectsArea();
-    onYChanged: root.updateEffectsArea();
-
     EnvironmentActions {
         id: environmentActions
         active: root.scrollAction !== LatteContainment.Types.ScrollNone || root.dragActiveWindowEnabled || root.closeActiveWindowEnabled
@@ -45,7 +45,6 @@ Item {
     signal destroyInternalViewSplitters();
     signal emptyAreasWheel(QtObject wheel);
     signal separatorsUpdated();
-    signal updateEffectsArea();
     signal updateIndexes();
 
     signal broadcastedToApplet(string pluginName, string action, variant value);
@@ -810,6 +809,26 @@ Item {
             }
         }
 
+        //! Built-in indicators of all applets and tasks
+        LatteCore.IndicatorsRenderer {
+            id: indicatorsRenderer
+            anchors.fill: layoutsContainer
+
+            configuration: _indicators.nativeRenderer ? _indicators.configuration : null
+            location: plasmoid.location
+            iconSize: _metrics.iconSize
+            screenEdgeMargin: Math.max(0, _metrics.margin.screenEdge)
+
+            activeColor: colorizerManager.applyTheme.buttonFocusColor
+            textColor: colorizerManager.applyTheme.textColor
+            attentionColor: colorizerManager.applyTheme.negativeTextColor
+            contrastColor: _myView.itemShadow.shadowSolidColor
+
+            lineAnimationDuration: _animations.speedFactor.current * 0.75 * LatteCore.Environment.longDuration
+            attentionAnimationDuration: Math.max(1.65 * 3 * LatteCore.Environment.longDuration,
+                                                 _animations.speedFactor.current * 3 * LatteCore.Environment.longDuration)
+        }
+
         Layouts.LayoutsContainer {
             id: layoutsContainer
         }
@@ -986,6 +1005,7 @@ Item {
     Ability.Indicators{
         id: _indicators
         view: dockView
+        renderer: indicatorsRenderer
     }
 
     Ability.Launchers {
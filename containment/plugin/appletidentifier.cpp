@@ -0,0 +1,555 @@
+/* This file is a part of the Atmo desktop experience's SynDock project for SynOS.
+ * Copyright (C) 2026 Syndromatic Ltd. All rights reserved
+ * Designed by Kavish Krishnakumar in Manchester.
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "appletidentifier.h"
+
+// Qt
+#include <QStringList>
+
+namespace Latte{
+namespace Containment{
+
+//! applets that haven't identified properly their Latte behavior and
+//! create broken results when used in Latte
+static const QStringList BLACKLISTEDAPPLETS = {QStringLiteral("org.kde.redshiftControl"),
+                                               QStringLiteral("org.kde.plasma.notifications"),
+                                               QStringLiteral("menuZ")};
+
+QHash<QString, AppletIdentifier::ItemPaths> AppletIdentifier::s_paths;
+
+AppletIdentifier::AppletIdentifier(QObject *parent)
+    : QObject(parent)
+{
+    //! all changes of the same event loop turn are identified once
+    m_identifyTimer.setInterval(0);
+    m_identifyTimer.setSingleShot(true);
+    connect(&m_identifyTimer, &QTimer::timeout, this, &AppletIdentifier::identify);
+}
+
+AppletIdentifier::~AppletIdentifier()
+{
+    clearWatched();
+}
+
+bool AppletIdentifier::isActive() const
+{
+    return m_active;
+}
+
+void AppletIdentifier::setActive(bool active)
+{
+    if (m_active == active) {
+        return;
+    }
+
+    m_active = active;
+
+    if (m_active) {
+        scheduleIdentify();
+    } else {
+        //! identified items are kept, applets that talk through latte bridge are identifying themselves
+        m_identifyTimer.stop();
+        clearWatched();
+    }
+
+    emit activeChanged();
+}
+
+bool AppletIdentifier::originalAppletBehavior() const
+{
+    return m_originalAppletBehavior;
+}
+
+void AppletIdentifier::setOriginalAppletBehavior(bool behavior)
+{
+    if (m_originalAppletBehavior == behavior) {
+        return;
+    }
+
+    m_originalAppletBehavior = behavior;
+    scheduleIdentify();
+    emit originalAppletBehaviorChanged();
+}
+
+QString AppletIdentifier::pluginName() const
+{
+    return m_pluginName;
+}
+
+void AppletIdentifier::setPluginName(const QString &name)
+{
+    if (m_pluginName == name) {
+        return;
+    }
+
+    m_pluginName = name;
+    scheduleIdentify();
+    emit pluginNameChanged();
+}
+
+QQuickItem *AppletIdentifier::applet() const
+{
+    return m_applet;
+}
+
+void AppletIdentifier::setApplet(QQuickItem *applet)
+{
+    if (m_applet == applet) {
+        return;
+    }
+
+    m_applet = applet;
+
+    if (!m_applet) {
+        clearWatched();
+        setRootItem(nullptr);
+        setIconItem(nullptr);
+        setImageItem(nullptr);
+    } else {
+        scheduleIdentify();
+    }
+
+    emit appletChanged();
+}
+
+QQuickItem *AppletIdentifier::rootItem() const
+{
+    return m_rootItem;
+}
+
+void AppletIdentifier::setRootItem(QQuickItem *item)
+{
+    if (m_rootItem == item) {
+        return;
+    }
+
+    m_rootItem = item;
+    emit rootItemChanged();
+}
+
+QQuickItem *AppletIdentifier::iconItem() const
+{
+    return m_iconItem;
+}
+
+void AppletIdentifier::setIconItem(QQuickItem *item)
+{
+    if (m_iconItem == item) {
+        return;
+    }
+
+    m_iconItem = item;
+    emit iconItemChanged();
+}
+
+QQuickItem *AppletIdentifier::imageItem() const
+{
+    return m_imageItem;
+}
+
+void AppletIdentifier::setImageItem(QQuickItem *item)
+{
+    if (m_imageItem == item) {
+        return;
+    }
+
+    m_imageItem = item;
+    emit imageItemChanged();
+}
+
+bool AppletIdentifier::typeOf(const QObject *object, const char *className)
+{
+    if (!object) {
+        return false;
+    }
+
+    //! qml types are named as "ClassName_QMLTYPE_12" or "ClassName_QML_12"
+    const QLatin1String name(object->metaObject()->className());
+    const QLatin1String type(className);
+
+    return name == type
+            || (name.startsWith(type) && name.mid(type.size()).startsWith(QLatin1String("_QML")));
+}
+
+bool AppletIdentifier::hasLatteBridge(const QObject *object)
+{
+    return object && object->metaObject()->indexOfProperty("latteBridge") >= 0;
+}
+
+void AppletIdentifier::scheduleIdentify()
+{
+    if (m_active && m_applet && !m_identifyTimer.isActive()) {
+        m_identifyTimer.start();
+    }
+}
+
+void AppletIdentifier::watch(QQuickItem *item)
+{
+    if (!item || m_watchedItems.contains(item)) {
+        return;
+    }
+
+    m_watchedItems << item;
+    m_watchedConnections << connect(item, &QQuickItem::childrenChanged, this, &AppletIdentifier::scheduleIdentify);
+}
+
+void AppletIdentifier::watchVisibility(QQuickItem *item)
+{
+    if (!item) {
+        return;
+    }
+
+    m_watchedConnections << connect(item, &QQuickItem::visibleChanged, this, &AppletIdentifier::scheduleIdentify);
+}
+
+void AppletIdentifier::clearWatched()
+{
+    for (const auto &connection : m_watchedConnections) {
+        disconnect(connection);
+    }
+
+    m_watchedConnections.clear();
+    m_watchedItems.clear();
+}
+
+QList<QQuickItem *> AppletIdentifier::watchedChildren(QQuickItem *item)
+{
+    if (!item) {
+        return QList<QQuickItem *>();
+    }
+
+    watch(item);
+    return item->childItems();
+}
+
+bool AppletIdentifier::hasMemoisedPaths() const
+{
+    //! applets without plugin id can not share their items paths
+    return !m_pluginName.isEmpty()
+            && m_pluginName != QLatin1String("org.kde.plasma.notes")
+            && m_pluginName != QLatin1String("org.kde.plasma.userswitcher");
+}
+
+QQuickItem *AppletIdentifier::itemAt(const QList<int> &path)
+{
+    QQuickItem *item = m_applet;
+
+    for (const int index : path) {
+        const QList<QQuickItem *> children = watchedChildren(item);
+
+        if (index < 0 || index >= children.count()) {
+            return nullptr;
+        }
+
+        item = children[index];
+    }
+
+    return item;
+}
+
+void AppletIdentifier::identify()
+{
+    clearWatched();
+
+    if (!m_active || !m_applet) {
+        return;
+    }
+
+    watch(m_applet);
+
+    ItemPaths tempPaths;
+    ItemPaths *paths = hasMemoisedPaths() ? &s_paths[m_pluginName] : &tempPaths;
+
+    QQuickItem *root{nullptr};
+
+    if (paths->hasRoot) {
+        root = itemAt(paths->root);
+
+        if (!hasLatteBridge(root)) {
+            root = nullptr;
+        }
+    }
+
+    if (!root) {
+        root = findRootItem(&paths->root);
+        paths->hasRoot = (root != nullptr);
+    }
+
+    setRootItem(root);
+
+    identifyMainItems(paths);
+}
+
+QQuickItem *AppletIdentifier::findRootItem(QList<int> *path)
+{
+    const QList<QQuickItem *> level0 = watchedChildren(m_applet);
+
+    for (int i=0; i<level0.count(); ++i) {
+        if (hasLatteBridge(level0[i])) {
+            *path = {i};
+            return level0[i];
+        }
+
+        const QList<QQuickItem *> level1 = watchedChildren(level0[i]);
+
+        for (int j=0; j<level1.count(); ++j) {
+            if (hasLatteBridge(level1[j])) {
+                *path = {i, j};
+                return level1[j];
+            }
+        }
+    }
+
+    path->clear();
+    return nullptr;
+}
+
+void AppletIdentifier::identifyMainItems(ItemPaths *paths)
+{
+    //! searching to find for that applet the first IconItem
+    //! which is going to be used in order to deactivate its active
+    //! from our MouseArea
+
+    if (m_pluginName == QLatin1String("org.kde.plasma.notes")) {
+        identifyNotes();
+        return;
+    } else if (m_pluginName == QLatin1String("org.kde.plasma.userswitcher")) {
+        identifyUserSwitcher();
+        return;
+    }
+
+    if (paths->hasMainItems) {
+        QQuickItem *icon = paths->icon.isEmpty() ? nullptr : itemAt(paths->icon);
+        QQuickItem *image = paths->image.isEmpty() ? nullptr : itemAt(paths->image);
+
+        if ((paths->icon.isEmpty() || typeOf(icon, "IconItem"))
+                && (paths->image.isEmpty() || typeOf(image, "QQuickImage"))) {
+            setIconItem(icon);
+            setImageItem(image);
+            return;
+        }
+    }
+
+    paths->icon.clear();
+    paths->image.clear();
+
+    if (m_pluginName == QLatin1String("org.kde.plasma.kickoff")
+            || m_pluginName == QLatin1String("org.kde.plasma.kickofflegacy")) {
+        identifyKickOff(paths);
+    } else if (m_pluginName == QLatin1String("org.kde.plasma.kicker")) {
+        identifyKicker(paths);
+    } else if (m_pluginName == QLatin1String("org.kde.plasma.simplemenu")) {
+        identifySimpleMenu(paths);
+    } else if (m_pluginName == QLatin1String("org.kde.comexpertise.plasma.kdeconnect.sms")) {
+        identifyKdeConnectSms(paths);
+    } else if (!BLACKLISTEDAPPLETS.contains(m_pluginName)) {
+        identifyGeneric(paths);
+    }
+
+    paths->hasMainItems = !paths->icon.isEmpty() || !paths->image.isEmpty();
+
+    setIconItem(paths->icon.isEmpty() ? nullptr : itemAt(paths->icon));
+    setImageItem(paths->image.isEmpty() ? nullptr : itemAt(paths->image));
+}
+
+void AppletIdentifier::identifyGeneric(ItemPaths *paths)
+{
+    const QList<QQuickItem *> level0 = watchedChildren(m_applet);
+
+    for (int i=0; i<level0.count(); ++i) {
+        const QList<QQuickItem *> level1 = watchedChildren(level0[i]);
+
+        for (int j=0; j<level1.count(); ++j) {
+            if (typeOf(level1[j], "CompactRepresentation")) {
+                const QList<QQuickItem *> level2 = watchedChildren(level1[j]);
+
+                for (int k=0; k<level2.count(); ++k) {
+                    if (typeOf(level2[k], "IconItem")) {
+                        paths->icon = {i, j, k};
+                        return;
+                    }
+                }
+            } else if (typeOf(level1[j], "IconItem")) {
+                paths->icon = {i, j};
+                return;
+            }
+        }
+    }
+}
+
+void AppletIdentifier::identifyKdeConnectSms(ItemPaths *paths)
+{
+    const QList<QQuickItem *> level0 = watchedChildren(m_applet);
+
+    for (int i=0; i<level0.count(); ++i) {
+        const QList<QQuickItem *> level1 = watchedChildren(level0[i]);
+
+        for (int j=0; j<level1.count(); ++j) {
+            const QList<QQuickItem *> level2 = watchedChildren(level1[j]);
+
+            for (int k=0; k<level2.count(); ++k) {
+                if (typeOf(level2[k], "IconItem")) {
+                    paths->icon = {i, j, k};
+                    return;
+                }
+            }
+        }
+    }
+}
+
+void AppletIdentifier::identifyKickOff(ItemPaths *paths)
+{
+    const QList<QQuickItem *> level0 = watchedChildren(m_applet);
+
+    for (int i=0; i<level0.count(); ++i) {
+        const QList<QQuickItem *> level1 = watchedChildren(level0[i]);
+
+        for (int j=0; j<level1.count(); ++j) {
+            if (!typeOf(level1[j], "QQuickMouseArea")) {
+                continue;
+            }
+
+            const QList<QQuickItem *> level2 = watchedChildren(level1[j]);
+
+            for (int k=0; k<level2.count(); ++k) {
+                if (typeOf(level2[k], "IconItem")) {
+                    paths->icon = {i, j, k};
+                    return;
+                }
+            }
+        }
+    }
+}
+
+void AppletIdentifier::identifyKicker(ItemPaths *paths)
+{
+    const QList<QQuickItem *> level0 = watchedChildren(m_applet);
+
+    for (int i=0; i<level0.count(); ++i) {
+        const QList<QQuickItem *> level1 = watchedChildren(level0[i]);
+
+        for (int j=0; j<level1.count(); ++j) {
+            if (!typeOf(level1[j], "CompactRepresentation")) {
+                continue;
+            }
+
+            const QList<QQuickItem *> level2 = watchedChildren(level1[j]);
+
+            for (int k=0; k<level2.count(); ++k) {
+                if (typeOf(level2[k], "IconItem")) {
+                    paths->icon = {i, j, k};
+                } else if (typeOf(level2[k], "QQuickImage")) {
+                    paths->image = {i, j, k};
+                }
+            }
+
+            return;
+        }
+    }
+}
+
+void AppletIdentifier::identifySimpleMenu(ItemPaths *paths)
+{
+    const QList<QQuickItem *> level0 = watchedChildren(m_applet);
+
+    if (level0.isEmpty()) {
+        return;
+    }
+
+    const QList<QQuickItem *> level1 = watchedChildren(level0[0]);
+
+    for (int j=0; j<level1.count(); ++j) {
+        if (typeOf(level1[j], "IconItem")) {
+            paths->icon = {0, j};
+        } else if (typeOf(level1[j], "QQuickImage")) {
+            paths->image = {0, j};
+        }
+    }
+}
+
+void AppletIdentifier::identifyNotes()
+{
+    //! notes icon lives in the compact representation that is owned by the applet parent
+    const QList<QQuickItem *> level0 = watchedChildren(m_applet->parentItem());
+
+    for (QQuickItem *item0 : level0) {
+        const QList<QQuickItem *> level1 = watchedChildren(item0);
+
+        for (QQuickItem *item1 : level1) {
+            if (!typeOf(item1, "CompactApplet")) {
+                continue;
+            }
+
+            auto compact = qobject_cast<QQuickItem *>(item1->property("compactRepresentation").value<QObject *>());
+
+            for (QQuickItem *item2 : watchedChildren(compact)) {
+                if (!typeOf(item2, "QQuickMouseArea")) {
+                    continue;
+                }
+
+                for (QQuickItem *item3 : watchedChildren(item2)) {
+                    if (typeOf(item3, "IconItem")) {
+                        setIconItem(item3);
+                        setImageItem(nullptr);
+                        return;
+                    }
+                }
+            }
+        }
+    }
+
+    setIconItem(nullptr);
+    setImageItem(nullptr);
+}
+
+void AppletIdentifier::identifyUserSwitcher()
+{
+    setImageItem(nullptr);
+
+    if (m_originalAppletBehavior) {
+        setIconItem(nullptr);
+        return;
+    }
+
+    for (QQuickItem *item0 : watchedChildren(m_applet)) {
+        for (QQuickItem *item1 : watchedChildren(item0)) {
+            if (!typeOf(item1, "QQuickMouseArea")) {
+                continue;
+            }
+
+            for (QQuickItem *item2 : watchedChildren(item1)) {
+                if (!typeOf(item2, "QQuickRow")) {
+                    continue;
+                }
+
+                QQuickItem *icon{nullptr};
+                QQuickItem *label{nullptr};
+
+                for (QQuickItem *item3 : watchedChildren(item2)) {
+                    if (typeOf(item3, "IconItem")) {
+                        icon = item3;
+                    } else if (typeOf(item3, "QQuickText")) {
+                        label = item3;
+                    }
+                }
+
+                //! the icon is used only when the user name is not shown
+                watchVisibility(label);
+
+                if (icon && label && !label->isVisible()) {
+                    setIconItem(icon);
+                    return;
+                }
+            }
+        }
+    }
+
+    setIconItem(nullptr);
+}
+
+}
+}
@@ -0,0 +1,130 @@
+/* This file is a part of the Atmo desktop experience's SynDock project for SynOS.
+ * Copyright (C) 2026 Syndromatic Ltd. All rights reserved
+ * Designed by Kavish Krishnakumar in Manchester.
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#ifndef CONTAINMENTAPPLETIDENTIFIER_H
+#define CONTAINMENTAPPLETIDENTIFIER_H
+
+// Qt
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QPointer>
+#include <QQuickItem>
+#include <QTimer>
+
+namespace Latte{
+namespace Containment{
+
+//! Locates the latte bridge root item and the main icon/image items of an applet.
+//! Child index paths that were found once are remembered per plugin id, so further
+//! applets of the same plugin are identified without walking their items tree.
+//! Identification is repeated only when a children list along the used paths changes.
+class AppletIdentifier : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(bool active READ isActive WRITE setActive NOTIFY activeChanged)
+    Q_PROPERTY(bool originalAppletBehavior READ originalAppletBehavior WRITE setOriginalAppletBehavior NOTIFY originalAppletBehaviorChanged)
+    Q_PROPERTY(QString pluginName READ pluginName WRITE setPluginName NOTIFY pluginNameChanged)
+    Q_PROPERTY(QQuickItem *applet READ applet WRITE setApplet NOTIFY appletChanged)
+
+    Q_PROPERTY(QQuickItem *rootItem READ rootItem NOTIFY rootItemChanged)
+    Q_PROPERTY(QQuickItem *iconItem READ iconItem NOTIFY iconItemChanged)
+    Q_PROPERTY(QQuickItem *imageItem READ imageItem NOTIFY imageItemChanged)
+
+public:
+    AppletIdentifier(QObject *parent = nullptr);
+    ~AppletIdentifier() override;
+
+    bool isActive() const;
+    void setActive(bool active);
+
+    bool originalAppletBehavior() const;
+    void setOriginalAppletBehavior(bool behavior);
+
+    QString pluginName() const;
+    void setPluginName(const QString &name);
+
+    QQuickItem *applet() const;
+    void setApplet(QQuickItem *applet);
+
+    QQuickItem *rootItem() const;
+    QQuickItem *iconItem() const;
+    QQuickItem *imageItem() const;
+
+signals:
+    void activeChanged();
+    void appletChanged();
+    void iconItemChanged();
+    void imageItemChanged();
+    void originalAppletBehaviorChanged();
+    void pluginNameChanged();
+    void rootItemChanged();
+
+private slots:
+    void identify();
+
+private:
+    //! child index paths starting from the applet item, shared between applets of the same plugin
+    struct ItemPaths {
+        bool hasRoot{false};
+        bool hasMainItems{false};
+        QList<int> root;
+        QList<int> icon;
+        QList<int> image;
+    };
+
+    void scheduleIdentify();
+    void watch(QQuickItem *item);
+    void watchVisibility(QQuickItem *item);
+    void clearWatched();
+
+    void setRootItem(QQuickItem *item);
+    void setIconItem(QQuickItem *item);
+    void setImageItem(QQuickItem *item);
+
+    bool hasMemoisedPaths() const;
+
+    QQuickItem *itemAt(const QList<int> &path);
+    QQuickItem *findRootItem(QList<int> *path);
+
+    void identifyMainItems(ItemPaths *paths);
+    void identifyGeneric(ItemPaths *paths);
+    void identifyKdeConnectSms(ItemPaths *paths);
+    void identifyKicker(ItemPaths *paths);
+    void identifyKickOff(ItemPaths *paths);
+    void identifyNotes();
+    void identifySimpleMenu(ItemPaths *paths);
+    void identifyUserSwitcher();
+
+    QList<QQuickItem *> watchedChildren(QQuickItem *item);
+
+    static bool typeOf(const QObject *object, const char *className);
+    static bool hasLatteBridge(const QObject *object);
+
+private:
+    bool m_active{true};
+    bool m_originalAppletBehavior{false};
+
+    QString m_pluginName;
+
+    QPointer<QQuickItem> m_applet;
+    QPointer<QQuickItem> m_rootItem;
+    QPointer<QQuickItem> m_iconItem;
+    QPointer<QQuickItem> m_imageItem;
+
+    //! items whose children lists or visibility were used during the last identification
+    QList<QQuickItem *> m_watchedItems;
+    QList<QMetaObject::Connection> m_watchedConnections;
+    QTimer m_identifyTimer;
+
+    static QHash<QString, ItemPaths> s_paths;
+};
+
+}
+}
+
+#endif
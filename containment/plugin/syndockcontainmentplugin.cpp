@@ -6,6 +6,7 @@
 #include "syndockcontainmentplugin.h"
 
 // local
+#include "appletidentifier.h"
 #include "layoutmanager.h"
 #include "types.h"
 
@@ -16,5 +17,6 @@ void SyndockContainmentPlugin::registerTypes(const char *uri)
 {
     Q_ASSERT(uri == QLatin1String("org.kde.syndock.private.containment"));
     qmlRegisterUncreatableType<Latte::Containment::Types>(uri, 0, 1, "Types", "SynDock Containment Types uncreatable");
+    qmlRegisterType<Latte::Containment::AppletIdentifier>(uri, 0, 1, "AppletIdentifier");
     qmlRegisterType<Latte::Containment::LayoutManager>(uri, 0, 1, "LayoutManager");
 }
@@ -27,26 +27,26 @@
 #include <Plasma/Corona>
 #include <Plasma/ServiceJob>
 
-const int MEMORYINDEX = 0;
-const int ACTIVELAYOUTSINDEX = 1;
-const int CURRENTLAYOUTSINDEX = 2;
-const int ACTIONSALWAYSSHOWN = 3;
-const int LAYOUTMENUINDEX = 4;
-const int VIEWLAYOUTINDEX = 5;
-const int VIEWTYPEINDEX = 6;
-
 namespace {
 constexpr auto SYNDOCK_DBUS_SERVICE = "org.syndromatic.syndock";
 constexpr auto SYNDOCK_DBUS_PATH = "/SynDock";
 constexpr auto SYNDOCK_DBUS_INTERFACE = "org.syndromatic.SynDock";
 constexpr auto SHOW_SETTINGS_ACTION = "_show_syndock_settings_dialog_";
 
-QDBusInterface syndockInterface()
+//! plain method calls, QDBusInterface introspects the remote object on construction
+QDBusMessage syndockMethodCall(const QString &method)
+{
+    return QDBusMessage::createMethodCall(QLatin1String(SYNDOCK_DBUS_SERVICE),
+                                          QLatin1String(SYNDOCK_DBUS_PATH),
+                                          QLatin1String(SYNDOCK_DBUS_INTERFACE),
+                                          method);
+}
+
+void callSynDock(const QString &method, const QVariantList &arguments = QVariantList())
 {
-    return QDBusInterface(QLatin1String(SYNDOCK_DBUS_SERVICE),
-                          QLatin1String(SYNDOCK_DBUS_PATH),
-                          QLatin1String(SYNDOCK_DBUS_INTERFACE),
-                          QDBusConnection::sessionBus());
+    QDBusMessage message = syndockMethodCall(method);
+    message.setArguments(arguments);
+    QDBusConnection::sessionBus().asyncCall(message);
 }
 }
 
@@ -174,43 +174,27 @@ void Menu::restore(const KConfigGroup &config)
     m_actions[NSE::Data::ContextMenu::PREFERENCESACTION] = new QAction(QIcon::fromTheme("configure"), i18nc("global settings window", "&Configure SynDock..."), this);
     this->containment()->actions()->addAction(NSE::Data::ContextMenu::PREFERENCESACTION, m_actions[NSE::Data::ContextMenu::PREFERENCESACTION]);
     connect(m_actions[NSE::Data::ContextMenu::PREFERENCESACTION], &QAction::triggered, [=](){
-        QDBusInterface iface = syndockInterface();
-
-        if (iface.isValid()) {
-            iface.call("showSettingsWindow", (int)PreferencesPage);
-        }
+        callSynDock(QStringLiteral("showSettingsWindow"), {(int)PreferencesPage});
     });
 
     //! Duplicate Action
     m_actions[NSE::Data::ContextMenu::DUPLICATEVIEWACTION] = new QAction(QIcon::fromTheme("edit-copy"), "Duplicate Dock as Template", this);
     connect(m_actions[NSE::Data::ContextMenu::DUPLICATEVIEWACTION], &QAction::triggered, [=](){
-        QDBusInterface iface = syndockInterface();
-
-        if (iface.isValid()) {
-            iface.call("duplicateView", containment()->id());
-        }
+        callSynDock(QStringLiteral("duplicateView"), {containment()->id()});
     });
     this->containment()->actions()->addAction(NSE::Data::ContextMenu::DUPLICATEVIEWACTION, m_actions[NSE::Data::ContextMenu::DUPLICATEVIEWACTION]);
 
     //! Export View Template Action
     m_actions[NSE::Data::ContextMenu::EXPORTVIEWTEMPLATEACTION] = new QAction(QIcon::fromTheme("document-export"), "Export as Template...", this);
     connect(m_actions[NSE::Data::ContextMenu::EXPORTVIEWTEMPLATEACTION], &QAction::triggered, [=](){
-        QDBusInterface iface = syndockInterface();
-
-        if (iface.isValid()) {
-            iface.call("exportViewTemplate", containment()->id());
-        }
+        callSynDock(QStringLiteral("exportViewTemplate"), {containment()->id()});
     });
     this->containment()->actions()->addAction(NSE::Data::ContextMenu::EXPORTVIEWTEMPLATEACTION, m_actions[NSE::Data::ContextMenu::EXPORTVIEWTEMPLATEACTION]);
 
     //! Remove Action
     m_actions[NSE::Data::ContextMenu::REMOVEVIEWACTION] = new QAction(QIcon::fromTheme("delete"), "Remove Dock", this);
     connect(m_actions[NSE::Data::ContextMenu::REMOVEVIEWACTION], &QAction::triggered, [=](){
-        QDBusInterface iface = syndockInterface();
-
-        if (iface.isValid()) {
-            iface.call("removeView", containment()->id());
-        }
+        callSynDock(QStringLiteral("removeView"), {containment()->id()});
     });
     this->containment()->actions()->addAction(NSE::Data::ContextMenu::REMOVEVIEWACTION, m_actions[NSE::Data::ContextMenu::REMOVEVIEWACTION]);
 
@@ -245,34 +229,7 @@ QList<QAction *> Menu::contextualActions()
     }
     actions << m_actions[NSE::Data::ContextMenu::EDITVIEWACTION];
 
-    m_data.clear();
-    m_viewTemplates.clear();
-    QDBusInterface iface = syndockInterface();
-
-    if (iface.isValid()) {
-        QDBusReply<QStringList> contextData = iface.call("contextMenuData", containment()->id());
-        m_data = contextData.value();
-
-        QDBusReply<QStringList> templatesData = iface.call("viewTemplatesData");
-        m_viewTemplates = templatesData.value();
-    }
-
-    if (m_data.size() <= VIEWTYPEINDEX) {
-        qWarning() << "Invalid context menu data from org.syndromatic.syndock; using safe defaults.";
-        m_data = {
-            QString::number(SingleLayout),
-            QString(),
-            QString(),
-            NSE::Data::ContextMenu::ACTIONSALWAYSVISIBLE.join(QStringLiteral(";;")),
-            QString(),
-            QString(),
-            QStringLiteral("0;;0;;0")
-        };
-    }
-
-    m_actionsAlwaysShown = m_data[ACTIONSALWAYSSHOWN].split(";;");
-
-    updateViewData();
+    updateSnapshot();
 
     QString configureActionText = (m_view.type == DockView) ? i18n("&Edit Dock...") : i18n("&Edit Panel...");
     if (m_view.isCloned) {
@@ -286,7 +243,6 @@ QList<QAction *> Menu::contextualActions()
     const QString exportTemplateText = (m_view.type == DockView) ? i18n("E&xport Dock as Template") : i18n("E&xport Panel as Template");
     m_actions[NSE::Data::ContextMenu::EXPORTVIEWTEMPLATEACTION]->setText(exportTemplateText);
 
-    m_activeLayoutNames = m_data[ACTIVELAYOUTSINDEX].split(";;");
     const QString moveText = (m_view.type == DockView) ? i18n("&Move Dock To Layout") : i18n("&Move Panel To Layout");
     m_actions[NSE::Data::ContextMenu::MOVEVIEWACTION]->setText(moveText);
 
@@ -298,6 +254,75 @@ QList<QAction *> Menu::contextualActions()
     return actions;
 }
 
+void Menu::resetSnapshot()
+{
+    m_snapshotVersion = 0;
+    m_memoryUsage = SingleLayout;
+    m_actionsAlwaysShown = NSE::Data::ContextMenu::ACTIONSALWAYSVISIBLE;
+    m_activeLayoutNames.clear();
+    m_currentLayoutNames.clear();
+    m_layouts.clear();
+    m_viewTemplates.clear();
+
+    m_viewLayoutName.clear();
+    m_view = ViewTypeData{ViewType::DockView, false, 0};
+}
+
+void Menu::updateSnapshot()
+{
+    QDBusMessage message = syndockMethodCall(QStringLiteral("contextMenuSnapshot"));
+    message << containment()->id() << m_snapshotVersion;
+
+    const QDBusReply<QVariantMap> reply = QDBusConnection::sessionBus().call(message);
+
+    if (!reply.isValid()) {
+        qWarning() << "Invalid context menu data from org.syndromatic.syndock; using safe defaults.";
+        resetSnapshot();
+        return;
+    }
+
+    const QVariantMap snapshot = reply.value();
+    const qulonglong version = snapshot.value(NSE::Data::ContextMenu::SNAPSHOTVERSION).toULongLong();
+
+    //! shared data are sent only when the dock snapshot changed since our last request
+    if (version != m_snapshotVersion && snapshot.contains(NSE::Data::ContextMenu::SNAPSHOTMENULAYOUTS)) {
+        m_snapshotVersion = version;
+        m_memoryUsage = snapshot.value(NSE::Data::ContextMenu::SNAPSHOTMEMORYUSAGE).toInt();
+        m_actionsAlwaysShown = snapshot.value(NSE::Data::ContextMenu::SNAPSHOTACTIONSALWAYSSHOWN).toStringList();
+        m_activeLayoutNames = snapshot.value(NSE::Data::ContextMenu::SNAPSHOTACTIVELAYOUTS).toStringList();
+        m_currentLayoutNames = snapshot.value(NSE::Data::ContextMenu::SNAPSHOTCURRENTLAYOUTS).toStringList();
+
+        const QStringList layoutNames = snapshot.value(NSE::Data::ContextMenu::SNAPSHOTMENULAYOUTS).toStringList();
+        const QStringList layoutIcons = snapshot.value(NSE::Data::ContextMenu::SNAPSHOTMENULAYOUTICONS).toStringList();
+        const QStringList backgroundIconLayouts = snapshot.value(NSE::Data::ContextMenu::SNAPSHOTBACKGROUNDICONLAYOUTS).toStringList();
+
+        m_layouts.clear();
+
+        for (int i=0; i<layoutNames.count() && i<layoutIcons.count(); ++i) {
+            LayoutInfo info;
+            info.layoutName = layoutNames[i];
+            info.isBackgroundFileIcon = backgroundIconLayouts.contains(layoutNames[i]);
+            info.iconName = layoutIcons[i];
+
+            m_layouts << info;
+        }
+
+        const QStringList templateNames = snapshot.value(NSE::Data::ContextMenu::SNAPSHOTTEMPLATENAMES).toStringList();
+        const QStringList templateIds = snapshot.value(NSE::Data::ContextMenu::SNAPSHOTTEMPLATEIDS).toStringList();
+
+        m_viewTemplates.clear();
+
+        for (int i=0; i<templateNames.count() && i<templateIds.count(); ++i) {
+            m_viewTemplates << ViewTemplateInfo{templateNames[i], templateIds[i]};
+        }
+    }
+
+    m_viewLayoutName = snapshot.value(NSE::Data::ContextMenu::SNAPSHOTVIEWLAYOUT).toString();
+    m_view.type = static_cast<ViewType>(snapshot.value(NSE::Data::ContextMenu::SNAPSHOTVIEWTYPE).toInt());
+    m_view.isCloned = snapshot.value(NSE::Data::ContextMenu::SNAPSHOTVIEWISCLONED).toBool();
+    m_view.clonesCount = snapshot.value(NSE::Data::ContextMenu::SNAPSHOTVIEWCLONESCOUNT).toInt();
+}
+
 QAction *Menu::action(const QString &name)
 {
     if (m_actions.contains(name)) {
@@ -353,45 +378,28 @@ void Menu::updateVisibleActions()
 
 void Menu::populateLayouts()
 {
-    m_switchLayoutsMenu->clear();
-
-    LayoutsMemoryUsage memoryUsage = static_cast<LayoutsMemoryUsage>((m_data[MEMORYINDEX]).toInt());
-    QStringList activeNames = m_data[ACTIVELAYOUTSINDEX].split(";;");
-    QStringList currentNames = m_data[CURRENTLAYOUTSINDEX].split(";;");
-
-    QList<LayoutInfo> layoutsmenulist;
-
-    QStringList layoutsdata = m_data[LAYOUTMENUINDEX].split(";;");
-
-    for (int i=0; i<layoutsdata.count(); ++i) {
-        QStringList cdata = layoutsdata[i].split("**");
-        if (cdata.count() < 3) {
-            continue;
-        }
-
-        LayoutInfo info;
-        info.layoutName = cdata[0];
-        info.isBackgroundFileIcon = cdata[1].toInt();
-        info.iconName = cdata[2];
-
-        layoutsmenulist << info;
+    if (m_snapshotVersion > 0 && m_layoutsMenuVersion == m_snapshotVersion) {
+        return;
     }
 
-    for (int i = 0; i < layoutsmenulist.count(); ++i) {
-        bool isActive = activeNames.contains(layoutsmenulist[i].layoutName);
+    m_layoutsMenuVersion = m_snapshotVersion;
+    m_switchLayoutsMenu->clear();
+
+    for (int i = 0; i < m_layouts.count(); ++i) {
+        bool isActive = m_activeLayoutNames.contains(m_layouts[i].layoutName);
 
-        bool isCurrent = ((memoryUsage == SingleLayout && isActive)
-                          || (memoryUsage == MultipleLayouts && currentNames.contains(layoutsmenulist[i].layoutName)));
+        bool isCurrent = ((m_memoryUsage == SingleLayout && isActive)
+                          || (m_memoryUsage == MultipleLayouts && m_currentLayoutNames.contains(m_layouts[i].layoutName)));
 
 
         QWidgetAction *action = new QWidgetAction(m_switchLayoutsMenu);
-        action->setText(layoutsmenulist[i].layoutName);
+        action->setText(m_layouts[i].layoutName);
         action->setCheckable(true);
         action->setChecked(isCurrent);
-        action->setData(layoutsmenulist[i].layoutName);
+        action->setData(m_layouts[i].layoutName);
 
         LayoutMenuItemWidget *menuitem = new LayoutMenuItemWidget(action, m_switchLayoutsMenu);
-        menuitem->setIcon(layoutsmenulist[i].isBackgroundFileIcon, layoutsmenulist[i].iconName);
+        menuitem->setIcon(m_layouts[i].isBackgroundFileIcon, m_layouts[i].iconName);
         action->setDefaultWidget(menuitem);
         m_switchLayoutsMenu->addAction(action);
     }
@@ -412,87 +420,55 @@ void Menu::populateLayouts()
 
 void Menu::populateMoveToLayouts()
 {
-    m_moveToLayoutMenu->clear();
-
-    LayoutsMemoryUsage memoryUsage = static_cast<LayoutsMemoryUsage>((m_data[MEMORYINDEX]).toInt());
-
-    if (memoryUsage == LayoutsMemoryUsage::MultipleLayouts) {
-        QStringList activeNames = m_data[ACTIVELAYOUTSINDEX].split(";;");
-        QStringList currentNames = m_data[CURRENTLAYOUTSINDEX].split(";;");
-        QString viewLayoutName = m_data[VIEWLAYOUTINDEX];
-
-        QList<LayoutInfo> layoutsmenulist;
-
-        QStringList layoutsdata = m_data[LAYOUTMENUINDEX].split(";;");
-
-        for (int i=0; i<layoutsdata.count(); ++i) {
-            QStringList cdata = layoutsdata[i].split("**");
-            if (cdata.count() < 3) {
-                continue;
-            }
-
-            LayoutInfo info;
-            info.layoutName = cdata[0];
-            info.isBackgroundFileIcon = cdata[1].toInt();
-            info.iconName = cdata[2];
+    if (m_snapshotVersion > 0
+            && m_moveToLayoutMenuVersion == m_snapshotVersion
+            && m_moveToLayoutMenuViewLayoutName == m_viewLayoutName) {
+        return;
+    }
 
-            layoutsmenulist << info;
-        }
+    m_moveToLayoutMenuVersion = m_snapshotVersion;
+    m_moveToLayoutMenuViewLayoutName = m_viewLayoutName;
+    m_moveToLayoutMenu->clear();
 
-        for (int i = 0; i < layoutsmenulist.count(); ++i) {
-            bool isCurrent = currentNames.contains(layoutsmenulist[i].layoutName) && activeNames.contains(layoutsmenulist[i].layoutName);
-            bool isViewCurrentLayout = layoutsmenulist[i].layoutName == viewLayoutName;
+    if (m_memoryUsage == LayoutsMemoryUsage::MultipleLayouts) {
+        for (int i = 0; i < m_layouts.count(); ++i) {
+            bool isViewCurrentLayout = m_layouts[i].layoutName == m_viewLayoutName;
 
             QWidgetAction *action = new QWidgetAction(m_moveToLayoutMenu);
-            action->setText(layoutsmenulist[i].layoutName);
+            action->setText(m_layouts[i].layoutName);
             action->setCheckable(true);
             action->setChecked(isViewCurrentLayout);
-            action->setData(isViewCurrentLayout ? QString() : layoutsmenulist[i].layoutName);
+            action->setData(isViewCurrentLayout ? QString() : m_layouts[i].layoutName);
 
             LayoutMenuItemWidget *menuitem = new LayoutMenuItemWidget(action, m_moveToLayoutMenu);
-            menuitem->setIcon(layoutsmenulist[i].isBackgroundFileIcon, layoutsmenulist[i].iconName);
+            menuitem->setIcon(m_layouts[i].isBackgroundFileIcon, m_layouts[i].iconName);
             action->setDefaultWidget(menuitem);
             m_moveToLayoutMenu->addAction(action);
         }
     }
 }
 
-void Menu::updateViewData()
-{
-    QStringList vdata = m_data[VIEWTYPEINDEX].split(";;");
-    if (vdata.count() < 3) {
-        m_view = ViewTypeData{ViewType::DockView, false, 0};
-        return;
-    }
-
-    m_view.type = static_cast<ViewType>((vdata[0]).toInt());
-    m_view.isCloned = vdata[1].toInt();
-    m_view.clonesCount = vdata[2].toInt();
-}
-
 void Menu::populateViewTemplates()
 {
-    m_addViewMenu->clear();
-
-    for(int i=0; i<m_viewTemplates.count(); ++i) {
-        if (i % 2 == 1) {
-            //! even records are the templates ids and they have already been registered
-            continue;
-        }
-        if (i + 1 >= m_viewTemplates.count()) {
-            break;
+    if (m_snapshotVersion == 0 || m_viewTemplatesMenuVersion != m_snapshotVersion || !m_duplicateTemplateAction) {
+        m_viewTemplatesMenuVersion = m_snapshotVersion;
+        m_addViewMenu->clear();
+
+        for(int i=0; i<m_viewTemplates.count(); ++i) {
+            QAction *templateAction = m_addViewMenu->addAction(m_viewTemplates[i].name);
+            templateAction->setIcon(QIcon::fromTheme("list-add"));
+            templateAction->setData(m_viewTemplates[i].id);
         }
 
-        QAction *templateAction = m_addViewMenu->addAction(m_viewTemplates[i]);
-        templateAction->setIcon(QIcon::fromTheme("list-add"));
-        templateAction->setData(m_viewTemplates[i+1]);
+        m_addViewMenu->addSeparator();
+        m_duplicateTemplateAction = m_addViewMenu->addAction(QString());
+        m_duplicateTemplateAction->setToolTip(m_actions[NSE::Data::ContextMenu::DUPLICATEVIEWACTION]->toolTip());
+        m_duplicateTemplateAction->setIcon(m_actions[NSE::Data::ContextMenu::DUPLICATEVIEWACTION]->icon());
+        connect(m_duplicateTemplateAction, &QAction::triggered, m_actions[NSE::Data::ContextMenu::DUPLICATEVIEWACTION], &QAction::triggered);
     }
 
-    m_addViewMenu->addSeparator();
-    QAction *duplicateAction = m_addViewMenu->addAction(m_actions[NSE::Data::ContextMenu::DUPLICATEVIEWACTION]->text());
-    duplicateAction->setToolTip(m_actions[NSE::Data::ContextMenu::DUPLICATEVIEWACTION]->toolTip());
-    duplicateAction->setIcon(m_actions[NSE::Data::ContextMenu::DUPLICATEVIEWACTION]->icon());
-    connect(duplicateAction, &QAction::triggered, m_actions[NSE::Data::ContextMenu::DUPLICATEVIEWACTION], &QAction::triggered);
+    //! dock and panel views use different texts
+    m_duplicateTemplateAction->setText(m_actions[NSE::Data::ContextMenu::DUPLICATEVIEWACTION]->text());
 }
 
 void Menu::addView(QAction *action)
@@ -500,11 +476,7 @@ void Menu::addView(QAction *action)
     const QString templateId = action->data().toString();
 
     QTimer::singleShot(400, [this, templateId]() {
-        QDBusInterface iface = syndockInterface();
-
-        if (iface.isValid()) {
-            iface.call("addView", containment()->id(), templateId);
-        }
+        callSynDock(QStringLiteral("addView"), {containment()->id(), templateId});
     });
 }
 
@@ -513,11 +485,7 @@ void Menu::moveToLayout(QAction *action)
     const QString layoutName = action->data().toString();
 
     QTimer::singleShot(400, [this, layoutName]() {
-        QDBusInterface iface = syndockInterface();
-
-        if (iface.isValid()) {
-            iface.call("moveViewToLayout", containment()->id(), layoutName);
-        }
+        callSynDock(QStringLiteral("moveViewToLayout"), {containment()->id(), layoutName});
     });
 }
 
@@ -527,30 +495,18 @@ void Menu::switchToLayout(QAction *action)
 
     if (layout == QLatin1String(SHOW_SETTINGS_ACTION)) {
         QTimer::singleShot(400, [this]() {
-            QDBusInterface iface = syndockInterface();
-
-            if (iface.isValid()) {
-                iface.call("showSettingsWindow", (int)LayoutPage);
-            }
+            callSynDock(QStringLiteral("showSettingsWindow"), {(int)LayoutPage});
         });
     } else {
         QTimer::singleShot(400, [this, layout]() {
-            QDBusInterface iface = syndockInterface();
-
-            if (iface.isValid()) {
-                iface.call("switchToLayout", layout);
-            }
+            callSynDock(QStringLiteral("switchToLayout"), {layout});
         });
     }
 }
 
 void Menu::quitApplication()
 {
-    QDBusInterface iface = syndockInterface();
-
-    if (iface.isValid()) {
-        iface.call("quitApplication");
-    }
+    callSynDock(QStringLiteral("quitApplication"));
 }
 
 K_PLUGIN_CLASS_WITH_JSON(Menu, "plasma-containmentactions-lattecontextmenu.json")
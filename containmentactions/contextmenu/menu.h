@@ -27,6 +27,11 @@ struct LayoutInfo {
     QString iconName;
 };
 
+struct ViewTemplateInfo {
+    QString name;
+    QString id;
+};
+
 struct ViewTypeData {
     ViewType type{ViewType::DockView};
     bool isCloned{true};
@@ -52,7 +57,6 @@ private Q_SLOTS:
     void quitApplication();
     void requestConfiguration();
     void requestWidgetExplorer();
-    void updateViewData();
     void updateVisibleActions();
 
     void addView(QAction *action);
@@ -60,11 +64,29 @@ private Q_SLOTS:
     void switchToLayout(QAction *action);
 
 private:
-    QStringList m_data;
-    QStringList m_viewTemplates;
+    //! fetches the dock snapshot, shared data are transferred only when they changed
+    void updateSnapshot();
+    void resetSnapshot();
+
+private:
+    //! version of the dock snapshot that shared data below come from
+    qulonglong m_snapshotVersion{0};
+    //! snapshot versions the submenus were populated from
+    qulonglong m_layoutsMenuVersion{0};
+    qulonglong m_moveToLayoutMenuVersion{0};
+    qulonglong m_viewTemplatesMenuVersion{0};
+
+    int m_memoryUsage{0};
+
+    QString m_viewLayoutName;
+    QString m_moveToLayoutMenuViewLayoutName;
 
     QStringList m_actionsAlwaysShown;
     QStringList m_activeLayoutNames;
+    QStringList m_currentLayoutNames;
+
+    QList<LayoutInfo> m_layouts;
+    QList<ViewTemplateInfo> m_viewTemplates;
 
     ViewTypeData m_view;
 
@@ -73,6 +95,8 @@ private:
     QMenu *m_addViewMenu{nullptr};
     QMenu *m_switchLayoutsMenu{nullptr};
     QMenu *m_moveToLayoutMenu{nullptr};
+
+    QAction *m_duplicateTemplateAction{nullptr};
 };
 
 #endif
@@ -18,6 +18,7 @@ AbilityDefinition.Indicators {
     configuration: ref.indicators.configuration
     resources: ref.indicators.resources
     indicatorComponent: ref.indicators.indicatorComponent
+    nativeRenderer: ref.indicators.nativeRenderer
 
     Item {
         id: ref
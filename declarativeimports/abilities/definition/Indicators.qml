@@ -19,6 +19,9 @@ Item{
 
     property Component indicatorComponent
 
+    //! draws the built-in indicator style for all items at once, null when items must load indicatorComponent
+    property Item nativeRenderer: null
+
     property IndicatorTypes.IndicatorInfo info: IndicatorTypes.IndicatorInfo{
         enabledForApplets: true
         needsIconColors: false
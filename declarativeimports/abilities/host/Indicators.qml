@@ -21,6 +21,7 @@ AbilityDefinition.Indicators {
         readonly property alias resources: apis.resources
 
         readonly property alias indicatorComponent: apis.indicatorComponent
+        readonly property alias nativeRenderer: apis.nativeRenderer
 
         readonly property alias info: apis.info
     }
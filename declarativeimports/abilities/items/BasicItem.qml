@@ -78,6 +78,8 @@ Item{
     }
 
     property bool isMonochromaticForcedContentItem: false
+    //! content item paints its own shadow and monochromatic tint, e.g. through LatteCore.IconItem baking
+    property bool contentItemBakesEffects: false
 
     property bool isHiddenSpacerAnimated: true
     property bool isHiddenSpacerForcedShow: false
@@ -17,8 +17,28 @@ Loader {
             && level.indicator.configuration
             && (level.isBackground || (level.isForeground && level.indicator.host.info.providesFrontLayer))
 
-    sourceComponent: level.indicator.host ? level.indicator.host.indicatorComponent : null
+    sourceComponent: {
+        if (!level.indicator.host) {
+            return null;
+        }
+
+        return isNativelyRendered ? nativeIndicator : level.indicator.host.indicatorComponent;
+    }
+
+    //! items that are drawn in the view can provide their indicator state to the native renderer
+    property bool nativeRenderingEnabled: false
+    readonly property bool isNativelyRendered: nativeRenderingEnabled
+                                               && level.isBackground
+                                               && level.indicator.host
+                                               && level.indicator.host.nativeRenderer !== null
 
     readonly property IndicatorItem.LevelOptions level: IndicatorItem.LevelOptions{}
+
+    Component {
+        id: nativeIndicator
+        IndicatorItem.NativeIndicator {
+            level: indicatorLevelLoader.level
+        }
+    }
 }
 
@@ -23,6 +23,7 @@ AbilityItem.IndicatorLevel {
     width: abilityItem.isHorizontal ? length : thickness
     height: abilityItem.isHorizontal ? thickness : length
 
+    nativeRenderingEnabled: true
     level.isDrawn: level.indicator && level.indicator.host && level.indicator.host.isEnabled && !abilityItem.isSeparator && !abilityItem.isHidden
 
     readonly property real length: abilityItem.preserveIndicatorInInitialPosition ?
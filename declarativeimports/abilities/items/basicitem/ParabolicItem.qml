@@ -122,6 +122,7 @@ Item{
             anchors.fill: _contentItemContainer
             active: abilityItem.abilities.myView.itemShadow.isEnabled
                     && !abilityItem.isSeparator
+                    && !abilityItem.contentItemBakesEffects
                     && abilityItem.abilities.environment.isGraphicsSystemAccelerated
 
             sourceComponent: DropShadow{
@@ -210,7 +211,9 @@ Item{
         //! Latte Side Painting-style if the user chose it
         Loader{
             anchors.fill: _contentItemContainer
-            active: abilityItem.isMonochromaticForcedContentItem && abilityItem.monochromizedItem
+            active: abilityItem.isMonochromaticForcedContentItem
+                    && abilityItem.monochromizedItem
+                    && !abilityItem.contentItemBakesEffects
 
             sourceComponent: ColorOverlay {
                 anchors.fill: parent
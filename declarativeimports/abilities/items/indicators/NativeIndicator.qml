@@ -0,0 +1,74 @@
+/*
+ * This file is a part of the Atmo desktop experience's SynDock project for SynOS.
+ * Copyright (C) 2026 Syndromatic Ltd. All rights reserved
+ * Designed by Kavish Krishnakumar in Manchester.
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+import QtQuick
+
+import org.kde.syndock.core 0.2 as LatteCore
+
+//! Provides the item state to the native indicators renderer, the renderer tracks
+//! this item geometry and draws the indicator in its own scene graph node
+Item {
+    id: nativeIndicator
+
+    property Item level: null
+
+    readonly property Item indicator: level ? level.indicator : null
+    readonly property Item renderer: indicator && indicator.host ? indicator.host.nativeRenderer : null
+
+    readonly property int flags: {
+        if (!indicator) {
+            return LatteCore.IndicatorsRenderer.NoState;
+        }
+
+        return (indicator.isTask ? LatteCore.IndicatorsRenderer.IsTask : 0)
+                | (indicator.isApplet ? LatteCore.IndicatorsRenderer.IsApplet : 0)
+                | (indicator.isEmptySpace ? LatteCore.IndicatorsRenderer.IsEmptySpace : 0)
+                | (indicator.isLauncher ? LatteCore.IndicatorsRenderer.IsLauncher : 0)
+                | (indicator.isActive ? LatteCore.IndicatorsRenderer.IsActive : 0)
+                | (indicator.isGroup ? LatteCore.IndicatorsRenderer.IsGroup : 0)
+                | (indicator.isMinimized ? LatteCore.IndicatorsRenderer.IsMinimized : 0)
+                | (indicator.inAttention ? LatteCore.IndicatorsRenderer.InAttention : 0)
+                | (indicator.inRemoving ? LatteCore.IndicatorsRenderer.InRemoving : 0)
+                | (indicator.hasActive ? LatteCore.IndicatorsRenderer.HasActive : 0)
+                | (indicator.hasMinimized ? LatteCore.IndicatorsRenderer.HasMinimized : 0)
+                | (indicator.hasShown ? LatteCore.IndicatorsRenderer.HasShown : 0);
+    }
+
+    property int slot: -1
+    property Item registeredRenderer: null
+
+    onFlagsChanged: {
+        if (registeredRenderer && slot >= 0) {
+            registeredRenderer.setItemFlags(slot, flags);
+        }
+    }
+
+    Component.onCompleted: {
+        if (level) {
+            //! restore the values that QML indicators may have requested before
+            level.requested.iconOffsetX = 0;
+            level.requested.iconOffsetY = 0;
+            level.requested.iconTransformOrigin = Item.Center;
+            level.requested.iconOpacity = 1.0;
+            level.requested.iconRotation = 0;
+            level.requested.iconScale = 1.0;
+            level.requested.isTaskLauncherAnimationRunning = false;
+        }
+
+        if (renderer) {
+            registeredRenderer = renderer;
+            slot = registeredRenderer.addItem(nativeIndicator, flags);
+        }
+    }
+
+    Component.onDestruction: {
+        if (registeredRenderer && slot >= 0) {
+            registeredRenderer.removeItem(slot);
+        }
+    }
+}
@@ -13,14 +13,20 @@
 
 // local
 #include "extras.h"
+#include "notchedtexturenode.h"
 
 // Qt
+#include <QCache>
+#include <QCoreApplication>
 #include <QDebug>
+#include <QHash>
 #include <QPainter>
 #include <QPaintEngine>
 #include <QQuickWindow>
 #include <QPixmap>
+#include <QPointer>
 #include <QSGSimpleTextureNode>
+#include <QThreadPool>
 #include <QuickAddons/ManagedTextureNode>
 #include <QLatin1String>
 
@@ -29,8 +35,131 @@
 #include <KIconThemes/KIconLoader>
 #include <KIconThemes/KIconEffect>
 
+// C++
+#include <cmath>
+
 namespace Latte {
 
+namespace {
+//! same vertical offset that the items DropShadow was using
+const int SHADOWVERTICALOFFSET = 2;
+//! baked icons are requested at multiples of this size in device pixels,
+//! that way the parabolic zoom steps reuse the same texture
+const int BAKEDSIZESTEP = 8;
+
+struct BakedIcon {
+    QImage image;
+    qreal marginRatio{0};
+};
+
+//! shared between all icon items of the process, cost is measured in KB
+QCache<QString, BakedIcon> &bakedIcons()
+{
+    static QCache<QString, BakedIcon> cache(16 * 1024);
+    return cache;
+}
+
+//! box blur with out of bounds pixels treated as transparent, image must be premultiplied
+void boxBlur(QImage &image, int radius, bool horizontal)
+{
+    const int lines = horizontal ? image.height() : image.width();
+    const int length = horizontal ? image.width() : image.height();
+    const int step = horizontal ? 1 : image.bytesPerLine() / 4;
+    const int window = 2 * radius + 1;
+    QVector<QRgb> line(length);
+
+    for (int l = 0; l < lines; ++l) {
+        QRgb *pixels = horizontal ? reinterpret_cast<QRgb *>(image.scanLine(l))
+                                  : reinterpret_cast<QRgb *>(image.bits()) + l;
+
+        for (int i = 0; i < length; ++i) {
+            line[i] = pixels[i * step];
+        }
+
+        int r{0}, g{0}, b{0}, a{0};
+
+        for (int i = 0; i <= radius && i < length; ++i) {
+            r += qRed(line[i]); g += qGreen(line[i]); b += qBlue(line[i]); a += qAlpha(line[i]);
+        }
+
+        for (int i = 0; i < length; ++i) {
+            pixels[i * step] = qRgba(r / window, g / window, b / window, a / window);
+
+            const int incoming = i + radius + 1;
+            const int outgoing = i - radius;
+
+            if (incoming < length) {
+                r += qRed(line[incoming]); g += qGreen(line[incoming]); b += qBlue(line[incoming]); a += qAlpha(line[incoming]);
+            }
+
+            if (outgoing >= 0) {
+                r -= qRed(line[outgoing]); g -= qGreen(line[outgoing]); b -= qBlue(line[outgoing]); a -= qAlpha(line[outgoing]);
+            }
+        }
+    }
+}
+
+//! paints the icon centered in a square of pixelSize and tinted
+QImage paintIcon(const QPixmap &icon, int pixelSize, const QColor &tint)
+{
+    QImage iconImage(pixelSize, pixelSize, QImage::Format_ARGB32_Premultiplied);
+    iconImage.fill(Qt::transparent);
+
+    QPainter painter(&iconImage);
+    painter.setRenderHint(QPainter::SmoothPixmapTransform);
+    const QSize iconSize = icon.size().scaled(pixelSize, pixelSize, Qt::KeepAspectRatio);
+    painter.drawPixmap(QRect(QPoint((pixelSize - iconSize.width()) / 2, (pixelSize - iconSize.height()) / 2), iconSize), icon);
+
+    if (tint.isValid() && tint.alpha() > 0) {
+        painter.setCompositionMode(QPainter::CompositionMode_SourceIn);
+        painter.fillRect(iconImage.rect(), tint);
+    }
+
+    painter.end();
+
+    return iconImage;
+}
+
+//! paints the icon image with its shadow underneath, it only touches images so it
+//! can run outside the gui thread. margin returns the shadow extent around the icon
+//! square in device pixels
+QImage bakeShadow(const QImage &iconImage, int shadowSize, const QColor &shadowColor, qreal dpr, int &margin)
+{
+    //! three box blurs approximate the gaussian that DropShadow uses for the same radius
+    const qreal deviation = ((shadowSize + 1) / 3.3333) * dpr;
+    const int boxRadius = qMax(1, qRound((std::sqrt(4 * deviation * deviation + 1) - 1) / 2));
+    const int offset = qRound(SHADOWVERTICALOFFSET * dpr);
+    margin = 3 * boxRadius + offset;
+
+    QImage baked(iconImage.width() + 2 * margin, iconImage.height() + 2 * margin, QImage::Format_ARGB32_Premultiplied);
+    baked.fill(Qt::transparent);
+
+    QPainter painter(&baked);
+    painter.drawImage(margin, margin + offset, iconImage);
+    painter.setCompositionMode(QPainter::CompositionMode_SourceIn);
+    painter.fillRect(baked.rect(), shadowColor);
+    painter.end();
+
+    for (int pass = 0; pass < 3; ++pass) {
+        boxBlur(baked, boxRadius, true);
+        boxBlur(baked, boxRadius, false);
+    }
+
+    painter.begin(&baked);
+    painter.drawImage(margin, margin, iconImage);
+    painter.end();
+
+    return baked;
+}
+
+//! icon items waiting for a shadow that is baked in the background, by baked icon key
+QHash<QString, QList<QPointer<IconItem>>> &pendingBakes()
+{
+    static QHash<QString, QList<QPointer<IconItem>>> pending;
+    return pending;
+}
+}
+
 IconItem::IconItem(QQuickItem *parent)
     : QQuickItem(parent),
       m_active(false),
@@ -54,6 +183,24 @@ IconItem::IconItem(QQuickItem *parent)
             this, SLOT(schedulePixmapUpdate()));
     connect(this, SIGNAL(providesColorsChanged()),
             this, SLOT(schedulePixmapUpdate()));
+    connect(this, &IconItem::tintColorChanged,
+            this, &IconItem::schedulePixmapUpdate);
+    connect(this, &IconItem::shadowSizeChanged,
+            this, &IconItem::schedulePixmapUpdate);
+    connect(this, &IconItem::shadowColorChanged,
+            this, &IconItem::schedulePixmapUpdate);
+    //! notches are cut while rendering, they never touch the baked icon
+    connect(this, &IconItem::notchesChanged,
+            this, &QQuickItem::update);
+
+    //! baked icons become stale when the icon theme changes
+    connect(KIconLoader::global(), &KIconLoader::iconLoaderSettingsChanged, this, [this]() {
+        bakedIcons().clear();
+
+        if (isBaking()) {
+            schedulePixmapUpdate();
+        }
+    });
 
     //initialize implicit size to the Dialog size
     setImplicitWidth(KIconLoader::global()->currentSize(KIconLoader::Dialog));
@@ -285,6 +432,190 @@ void IconItem::setProvidesColors(const bool provides)
     emit providesColorsChanged();
 }
 
+QColor IconItem::tintColor() const
+{
+    return m_tintColor;
+}
+
+void IconItem::setTintColor(const QColor &color)
+{
+    if (m_tintColor == color) {
+        return;
+    }
+
+    m_tintColor = color;
+    emit tintColorChanged();
+}
+
+int IconItem::shadowSize() const
+{
+    return m_shadowSize;
+}
+
+void IconItem::setShadowSize(int size)
+{
+    size = qMax(0, size);
+
+    if (m_shadowSize == size) {
+        return;
+    }
+
+    m_shadowSize = size;
+    emit shadowSizeChanged();
+}
+
+QColor IconItem::shadowColor() const
+{
+    return m_shadowColor;
+}
+
+void IconItem::setShadowColor(const QColor &color)
+{
+    if (m_shadowColor == color) {
+        return;
+    }
+
+    m_shadowColor = color;
+    emit shadowColorChanged();
+}
+
+bool IconItem::infoNotch() const
+{
+    return m_infoNotch;
+}
+
+void IconItem::setInfoNotch(bool notch)
+{
+    if (m_infoNotch == notch) {
+        return;
+    }
+
+    m_infoNotch = notch;
+    emit notchesChanged();
+}
+
+qreal IconItem::infoNotchWidth() const
+{
+    return m_infoNotchWidth;
+}
+
+void IconItem::setInfoNotchWidth(qreal width)
+{
+    if (qFuzzyCompare(m_infoNotchWidth, width)) {
+        return;
+    }
+
+    m_infoNotchWidth = width;
+
+    if (m_infoNotch) {
+        emit notchesChanged();
+    }
+}
+
+qreal IconItem::notchesProgress() const
+{
+    return m_notchesProgress;
+}
+
+void IconItem::setNotchesProgress(qreal progress)
+{
+    progress = qBound(0.0, progress, 1.0);
+
+    if (qFuzzyCompare(m_notchesProgress, progress)) {
+        return;
+    }
+
+    m_notchesProgress = progress;
+
+    if (m_infoNotch || m_audioNotch) {
+        emit notchesChanged();
+    }
+}
+
+bool IconItem::audioNotch() const
+{
+    return m_audioNotch;
+}
+
+void IconItem::setAudioNotch(bool notch)
+{
+    if (m_audioNotch == notch) {
+        return;
+    }
+
+    m_audioNotch = notch;
+    emit notchesChanged();
+}
+
+bool IconItem::notchesMirrored() const
+{
+    return m_notchesMirrored;
+}
+
+void IconItem::setNotchesMirrored(bool mirrored)
+{
+    if (m_notchesMirrored == mirrored) {
+        return;
+    }
+
+    m_notchesMirrored = mirrored;
+
+    if (m_infoNotch || m_audioNotch) {
+        emit notchesChanged();
+    }
+}
+
+bool IconItem::isBaking() const
+{
+    return (m_tintColor.isValid() && m_tintColor.alpha() > 0) || m_shadowSize > 0;
+}
+
+bool IconItem::hasNotches() const
+{
+    return (m_infoNotch || m_audioNotch) && m_notchesProgress > 0;
+}
+
+IconNotches IconItem::notches(qreal iconSize) const
+{
+    IconNotches notches;
+    notches.progress = m_notchesProgress;
+
+    if (m_infoNotch) {
+        const qreal width = qMax(m_infoNotchWidth / iconSize, 0.5);
+        notches.infoRounded = QRectF(m_notchesMirrored ? 0 : 1 - width, 0, width, 0.5);
+        notches.infoCorner = QRectF(m_notchesMirrored ? 0 : 1 - width / 2, 0, width / 2, 0.25);
+    }
+
+    if (m_audioNotch) {
+        notches.audioRounded = QRectF(m_notchesMirrored ? 0.5 : 0, 0, 0.5, 0.5);
+        notches.audioCorner = QRectF(m_notchesMirrored ? 0.75 : 0, 0, 0.25, 0.25);
+    }
+
+    return notches;
+}
+
+QString IconItem::bakedIconKey(int pixelSize) const
+{
+    //! only named icons can be shared, QIcon/QImage sources get per item ids and
+    //! plasma theme svgs follow the theme colors
+    if (m_lastLoadedSourceId.isEmpty()
+            || m_lastLoadedSourceId != m_lastValidSourceName
+            || (m_usesPlasmaTheme && m_svgIcon)) {
+        return QString();
+    }
+
+    const int state = !isEnabled() ? 0 : (m_active ? 2 : 1);
+    const bool tinted = m_tintColor.isValid() && m_tintColor.alpha() > 0;
+
+    return QStringLiteral("%1|%2|%3|%4|%5|%6|%7").arg(m_lastLoadedSourceId,
+                                                      m_overlays.join(QLatin1Char(',')),
+                                                      QString::number(state),
+                                                      QString::number(pixelSize),
+                                                      tinted ? m_tintColor.name(QColor::HexArgb) : QString(),
+                                                      QString::number(m_shadowSize),
+                                                      m_shadowSize > 0 ? m_shadowColor.name(QColor::HexArgb) : QString());
+}
+
 void IconItem::setSmooth(const bool smooth)
 {
     if (smooth == m_smooth) {
@@ -347,11 +678,49 @@ QSGNode *IconItem::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *update
 {
     Q_UNUSED(updatePaintNodeData)
 
-    if (m_iconPixmap.isNull() || width() < 1.0 || height() < 1.0) {
+    const bool baked = !m_bakedIcon.isNull();
+
+    if ((!baked && m_iconPixmap.isNull()) || width() < 1.0 || height() < 1.0) {
         delete oldNode;
         return nullptr;
     }
 
+    const auto iconSize = qMin(boundingRect().size().width(), boundingRect().size().height());
+    const QRectF iconRect(QPointF(boundingRect().center() - QPointF(iconSize / 2, iconSize / 2)), QSizeF(iconSize, iconSize));
+    //! the baked shadow is painted outside the item geometry
+    const qreal margin = baked ? iconSize * m_bakedMarginRatio : 0;
+    const QRectF destRect = iconRect.adjusted(-margin, -margin, margin, margin);
+    //! baked icons are scaled between the quantized baked sizes
+    const QSGTexture::Filtering filtering = baked || smooth() ? QSGTexture::Linear : QSGTexture::Nearest;
+
+    auto createTexture = [this, baked]() {
+        const QImage image = baked ? m_bakedIcon : m_iconPixmap.toImage();
+        return QSharedPointer<QSGTexture>(window()->createTextureFromImage(image, QQuickWindow::TextureCanUseAtlas));
+    };
+
+    //! notches are cut in the shader, so they can follow their animation without
+    //! touching the texture. Icons without notches keep the plain texture node
+    if (hasNotches()) {
+        NotchedTextureNode *notchedNode = dynamic_cast<NotchedTextureNode *>(oldNode);
+
+        if (!notchedNode || m_textureChanged) {
+            if (!notchedNode) {
+                delete oldNode;
+                notchedNode = new NotchedTextureNode;
+            }
+
+            notchedNode->setTexture(createTexture());
+            notchedNode->setFiltering(filtering);
+            m_textureChanged = false;
+        }
+
+        notchedNode->setRect(destRect, iconRect);
+        notchedNode->setNotches(notches(iconSize));
+        m_sizeChanged = false;
+
+        return notchedNode;
+    }
+
     ManagedTextureNode *textureNode = dynamic_cast<ManagedTextureNode *>(oldNode);
 
     if (!textureNode || m_textureChanged) {
@@ -359,16 +728,14 @@ QSGNode *IconItem::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *update
             delete oldNode;
 
         textureNode = new ManagedTextureNode;
-        textureNode->setTexture(QSharedPointer<QSGTexture>(window()->createTextureFromImage(m_iconPixmap.toImage(), QQuickWindow::TextureCanUseAtlas)));
-        textureNode->setFiltering(smooth() ? QSGTexture::Linear : QSGTexture::Nearest);
+        textureNode->setTexture(createTexture());
+        textureNode->setFiltering(filtering);
 
         m_sizeChanged = true;
         m_textureChanged = false;
     }
 
     if (m_sizeChanged) {
-        const auto iconSize = qMin(boundingRect().size().width(), boundingRect().size().height());
-        const QRectF destRect(QPointF(boundingRect().center() - QPointF(iconSize / 2, iconSize / 2)), QSizeF(iconSize, iconSize));
         textureNode->setRect(destRect);
         m_sizeChanged = false;
     }
@@ -472,12 +839,41 @@ void IconItem::loadPixmap()
         return;
     }
 
-    const auto size = qMin(width(), height());
+    auto size = qMin(width(), height());
     //final pixmap to paint
     QPixmap result;
 
+    const bool baking = isBaking();
+    const qreal dpr = window() ? window()->devicePixelRatio() : qApp->devicePixelRatio();
+    int bakedPixelSize{0};
+    QString bakedKey;
+
+    if (baking && size > 0) {
+        bakedPixelSize = static_cast<int>(std::ceil(size * dpr / BAKEDSIZESTEP)) * BAKEDSIZESTEP;
+        bakedKey = bakedIconKey(bakedPixelSize);
+        const bool needsColors = m_providesColors && m_lastLoadedSourceId != m_lastColorsSourceId;
+
+        if (!bakedKey.isEmpty() && !needsColors) {
+            if (const BakedIcon *cached = bakedIcons().object(bakedKey)) {
+                applyBakedIcon(cached->image, cached->marginRatio);
+                return;
+            }
+        }
+
+        size = bakedPixelSize / dpr;
+    }
+
+    //! any shadow still baking in the background is for an outdated request
+    m_pendingBakeKey.clear();
+
+    if (!baking) {
+        m_bakedIcon = QImage();
+        m_bakedMarginRatio = 0;
+    }
+
     if (size <= 0) {
         m_iconPixmap = QPixmap();
+        m_bakedIcon = QImage();
         update();
         return;
     } else if (m_svgIcon) {
@@ -510,12 +906,12 @@ void IconItem::loadPixmap()
             result = m_svgIcon->pixmap();
         }
     } else if (!m_icon.isNull()) {
-        result = m_icon.pixmap(QSize(static_cast<int>(size), static_cast<int>(size))
-                               * (window() ? window()->devicePixelRatio() : qApp->devicePixelRatio()));
+        result = m_icon.pixmap(QSize(static_cast<int>(size), static_cast<int>(size)) * dpr);
     } else if (!m_imageIcon.isNull()) {
         result = QPixmap::fromImage(m_imageIcon);
     } else {
         m_iconPixmap = QPixmap();
+        m_bakedIcon = QImage();
         update();
         return;
     }
@@ -542,6 +938,31 @@ void IconItem::loadPixmap()
 
     m_iconPixmap = result;
 
+    if (baking) {
+        const QImage iconImage = paintIcon(result, bakedPixelSize, m_tintColor);
+
+        if (m_shadowSize > 0) {
+            //! until the shadow is baked the previous baked icon of the same source is kept,
+            //! otherwise the icon is shown without its shadow
+            if (m_bakedIcon.isNull() || m_bakedSourceId != m_lastLoadedSourceId) {
+                m_bakedIcon = iconImage;
+                m_bakedMarginRatio = 0;
+            }
+
+            bakeShadowAsync(iconImage, bakedKey, dpr);
+        } else {
+            m_bakedIcon = iconImage;
+            m_bakedMarginRatio = 0;
+
+            if (!bakedKey.isEmpty()) {
+                const int cost = qMax(1, static_cast<int>(m_bakedIcon.sizeInBytes() / 1024));
+                bakedIcons().insert(bakedKey, new BakedIcon{m_bakedIcon, m_bakedMarginRatio}, cost);
+            }
+        }
+
+        m_bakedSourceId = m_lastLoadedSourceId;
+    }
+
     if (m_providesColors && m_lastLoadedSourceId != m_lastColorsSourceId) {
         m_lastColorsSourceId = m_lastLoadedSourceId;
         updateColors();
@@ -552,6 +973,63 @@ void IconItem::loadPixmap()
     update();
 }
 
+void IconItem::applyBakedIcon(const QImage &image, qreal marginRatio)
+{
+    m_pendingBakeKey.clear();
+    m_bakedIcon = image;
+    m_bakedMarginRatio = marginRatio;
+    m_bakedSourceId = m_lastLoadedSourceId;
+    m_textureChanged = true;
+    update();
+}
+
+void IconItem::bakeShadowAsync(const QImage &iconImage, const QString &bakedKey, qreal dpr)
+{
+    static int s_unsharedBakes{0};
+
+    //! unshared icons get a key of their own so their result is delivered only to them
+    const bool shared = !bakedKey.isEmpty();
+    m_pendingBakeKey = shared ? bakedKey : QStringLiteral("_unshared_%1").arg(++s_unsharedBakes);
+
+    auto &pending = pendingBakes();
+    const bool scheduled = pending.contains(m_pendingBakeKey);
+    auto &requesters = pending[m_pendingBakeKey];
+
+    if (!requesters.contains(this)) {
+        requesters << this;
+    }
+
+    if (scheduled) {
+        return;
+    }
+
+    const QString key = m_pendingBakeKey;
+    const int shadowSize = m_shadowSize;
+    const QColor shadowColor = m_shadowColor;
+
+    QThreadPool::globalInstance()->start([key, shared, iconImage, shadowSize, shadowColor, dpr]() {
+        int margin{0};
+        const QImage baked = bakeShadow(iconImage, shadowSize, shadowColor, dpr, margin);
+        const qreal marginRatio = static_cast<qreal>(margin) / iconImage.width();
+
+        QMetaObject::invokeMethod(qApp, [key, shared, baked, marginRatio]() {
+            if (shared) {
+                const int cost = qMax(1, static_cast<int>(baked.sizeInBytes() / 1024));
+                bakedIcons().insert(key, new BakedIcon{baked, marginRatio}, cost);
+            }
+
+            const auto requesters = pendingBakes().take(key);
+
+            for (const auto &item : requesters) {
+                //! items that requested something else meanwhile ignore the result
+                if (item && item->m_pendingBakeKey == key) {
+                    item->applyBakedIcon(baked, marginRatio);
+                }
+            }
+        }, Qt::QueuedConnection);
+    });
+}
+
 void IconItem::itemChange(ItemChange change, const ItemChangeData &value)
 {
     QQuickItem::itemChange(change, value);
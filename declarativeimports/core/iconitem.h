@@ -26,6 +26,8 @@
 
 // this file is based on PlasmaCore::IconItem class, thanks to KDE
 namespace Latte {
+struct IconNotches;
+
 class IconItem : public QQuickItem
 {
     Q_OBJECT
@@ -99,6 +101,43 @@ class IconItem : public QQuickItem
 
     Q_PROPERTY(QColor backgroundColor READ backgroundColor NOTIFY backgroundColorChanged)
     Q_PROPERTY(QColor glowColor READ glowColor NOTIFY glowColorChanged)
+
+    /**
+     * If set, the icon colors are replaced with this color keeping only the icon alpha.
+     * An invalid or fully transparent color disables tinting
+     */
+    Q_PROPERTY(QColor tintColor READ tintColor WRITE setTintColor NOTIFY tintColorChanged)
+
+    /**
+     * Radius of the drop shadow that is baked together with the icon in a single texture,
+     * 0 disables the shadow. The shadow is painted outside the item geometry
+     */
+    Q_PROPERTY(int shadowSize READ shadowSize WRITE setShadowSize NOTIFY shadowSizeChanged)
+    Q_PROPERTY(QColor shadowColor READ shadowColor WRITE setShadowColor NOTIFY shadowColorChanged)
+
+    /**
+     * Cuts the info/progress badge notch at the top corner of the icon. Its width is in item
+     * pixels and it is never narrower than half the icon. Notches are cut while rendering
+     * and are not part of the baked icon
+     */
+    Q_PROPERTY(bool infoNotch READ infoNotch WRITE setInfoNotch NOTIFY notchesChanged)
+    Q_PROPERTY(qreal infoNotchWidth READ infoNotchWidth WRITE setInfoNotchWidth NOTIFY notchesChanged)
+
+    /**
+     * How much the notches are cut, from 0 (not at all) to 1 (fully), so they can follow
+     * the badges show/hide animation
+     */
+    Q_PROPERTY(qreal notchesProgress READ notchesProgress WRITE setNotchesProgress NOTIFY notchesChanged)
+
+    /**
+     * Cuts the audio badge notch at the top corner of the icon opposite to the info notch
+     */
+    Q_PROPERTY(bool audioNotch READ audioNotch WRITE setAudioNotch NOTIFY notchesChanged)
+
+    /**
+     * By default the info notch is placed at the right and the audio notch at the left
+     */
+    Q_PROPERTY(bool notchesMirrored READ notchesMirrored WRITE setNotchesMirrored NOTIFY notchesChanged)
 public:
     IconItem(QQuickItem *parent = nullptr);
     virtual ~IconItem();
@@ -135,6 +174,30 @@ public:
 
     QColor glowColor() const;
 
+    QColor tintColor() const;
+    void setTintColor(const QColor &color);
+
+    int shadowSize() const;
+    void setShadowSize(int size);
+
+    QColor shadowColor() const;
+    void setShadowColor(const QColor &color);
+
+    bool infoNotch() const;
+    void setInfoNotch(bool notch);
+
+    qreal infoNotchWidth() const;
+    void setInfoNotchWidth(qreal width);
+
+    qreal notchesProgress() const;
+    void setNotchesProgress(qreal progress);
+
+    bool audioNotch() const;
+    void setAudioNotch(bool notch);
+
+    bool notchesMirrored() const;
+    void setNotchesMirrored(bool mirrored);
+
     void updatePolish() Q_DECL_OVERRIDE;
     QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *updatePaintNodeData) override;
 
@@ -149,11 +212,15 @@ signals:
     void colorGroupChanged();
     void glowColorChanged();
     void lastValidSourceNameChanged();
+    void notchesChanged();
     void overlaysChanged();
     void paintedSizeChanged();
     void providesColorsChanged();
+    void shadowColorChanged();
+    void shadowSizeChanged();
     void smoothChanged();
     void sourceChanged();
+    void tintColorChanged();
     void usesPlasmaThemeChanged();
     void validChanged();
 
@@ -163,6 +230,12 @@ private slots:
 
 private:
     void loadPixmap();
+    void applyBakedIcon(const QImage &image, qreal marginRatio);
+    void bakeShadowAsync(const QImage &iconImage, const QString &bakedKey, qreal dpr);
+    bool isBaking() const;
+    bool hasNotches() const;
+    IconNotches notches(qreal iconSize) const;
+    QString bakedIconKey(int pixelSize) const;
     void updateColors();
     void setLastLoadedSourceId(QString id);
     void setLastValidSourceName(QString name);
@@ -179,12 +252,32 @@ private:
     bool m_sizeChanged;
     bool m_usesPlasmaTheme;
 
+    bool m_infoNotch{false};
+    bool m_audioNotch{false};
+    bool m_notchesMirrored{false};
+
+    int m_shadowSize{0};
+
+    qreal m_infoNotchWidth{0};
+    qreal m_notchesProgress{1.0};
+
     QColor m_backgroundColor;
     QColor m_glowColor;
+    QColor m_shadowColor{Qt::black};
+    QColor m_tintColor;
 
     QIcon m_icon;
     QPixmap m_iconPixmap;
     QImage m_imageIcon;
+    //! icon with tint and shadow applied, it is shared between all items and scales
+    //! that request the same icon with the same effects
+    QImage m_bakedIcon;
+    //! shadow margin around the icon relative to the icon size
+    qreal m_bakedMarginRatio{0};
+    //! source that m_bakedIcon was baked from
+    QString m_bakedSourceId;
+    //! key of the shadow that is baked in the background for this item
+    QString m_pendingBakeKey;
     std::unique_ptr<Plasma::Svg> m_svgIcon;
     QString m_svgIconName;
 
@@ -0,0 +1,832 @@
+/* This file is a part of the Atmo desktop experience's SynDock project for SynOS.
+ * Copyright (C) 2026 Syndromatic Ltd. All rights reserved
+ * Designed by Kavish Krishnakumar in Manchester.
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+#include "indicatorsrenderer.h"
+
+// Qt
+#include <QQmlPropertyMap>
+#include <QQuickWindow>
+#include <QSGGeometryNode>
+#include <QSGVertexColorMaterial>
+
+// C++
+#include <cmath>
+#include <vector>
+
+namespace Latte {
+
+namespace {
+//! segments used for every half circle
+const int ARCSEGMENTS = 12;
+//! antialiasing fringe in pixels
+const qreal FRINGE = 1.0;
+
+struct GradientStop {
+    qreal position;
+    QColor color;
+};
+
+//! collects the triangles of all indicators, colors are premultiplied as QSGVertexColorMaterial expects
+class VertexPainter
+{
+public:
+    VertexPainter(std::vector<QSGGeometry::ColoredPoint2D> &vertices)
+        : m_vertices(vertices)
+    {
+    }
+
+    void setOpacity(qreal opacity)
+    {
+        m_opacity = opacity;
+    }
+
+    void triangle(const QPointF &p1, const QColor &c1, const QPointF &p2, const QColor &c2, const QPointF &p3, const QColor &c3)
+    {
+        vertex(p1, c1);
+        vertex(p2, c2);
+        vertex(p3, c3);
+    }
+
+    void quad(const QPointF &p1, const QColor &c1, const QPointF &p2, const QColor &c2,
+              const QPointF &p3, const QColor &c3, const QPointF &p4, const QColor &c4)
+    {
+        triangle(p1, c1, p2, c2, p3, c3);
+        triangle(p1, c1, p3, c3, p4, c4);
+    }
+
+    //! rounded rectangle whose radius is half its thickness, the same as the QML Rectangles were drawing
+    void capsule(const QRectF &rect, const QColor &color)
+    {
+        if (rect.isEmpty() || color.alpha() == 0) {
+            return;
+        }
+
+        const bool horizontal = rect.width() >= rect.height();
+        const qreal radius = qMin(rect.width(), rect.height()) / 2;
+        const QPointF firstCenter = horizontal ? QPointF(rect.left() + radius, rect.center().y()) : QPointF(rect.center().x(), rect.top() + radius);
+        const QPointF lastCenter = horizontal ? QPointF(rect.right() - radius, rect.center().y()) : QPointF(rect.center().x(), rect.bottom() - radius);
+        const qreal firstStart = horizontal ? M_PI / 2 : M_PI;
+
+        QVector<QPointF> normals;
+        normals.reserve(2 * (ARCSEGMENTS + 1));
+
+        for (int i = 0; i <= ARCSEGMENTS; ++i) {
+            const qreal angle = firstStart + (M_PI * i) / ARCSEGMENTS;
+            normals << QPointF(std::cos(angle), std::sin(angle));
+        }
+
+        for (int i = 0; i <= ARCSEGMENTS; ++i) {
+            const qreal angle = firstStart + M_PI + (M_PI * i) / ARCSEGMENTS;
+            normals << QPointF(std::cos(angle), std::sin(angle));
+        }
+
+        const QColor transparent(color.red(), color.green(), color.blue(), 0);
+        const QPointF center = rect.center();
+        const int count = normals.count();
+
+        auto outline = [&](int i) {
+            return (i <= ARCSEGMENTS ? firstCenter : lastCenter) + normals[i] * radius;
+        };
+
+        for (int i = 0; i < count; ++i) {
+            const int next = (i + 1) % count;
+            const QPointF p1 = outline(i);
+            const QPointF p2 = outline(next);
+
+            triangle(center, color, p1, color, p2, color);
+            quad(p1, color, p2, color, p2 + normals[next] * FRINGE, transparent, p1 + normals[i] * FRINGE, transparent);
+        }
+    }
+
+    //! half disc whose gradient stops are relative to its radius, startAngle is in radians
+    void radialHalfDisc(const QPointF &center, qreal radius, qreal startAngle, const QVector<GradientStop> &stops)
+    {
+        for (int i = 0; i < ARCSEGMENTS; ++i) {
+            const qreal a1 = startAngle + (M_PI * i) / ARCSEGMENTS;
+            const qreal a2 = startAngle + (M_PI * (i + 1)) / ARCSEGMENTS;
+            const QPointF d1(std::cos(a1), std::sin(a1));
+            const QPointF d2(std::cos(a2), std::sin(a2));
+
+            for (int s = 0; s < stops.count() - 1; ++s) {
+                const GradientStop &inner = stops[s];
+                const GradientStop &outer = stops[s + 1];
+
+                if (inner.color.alpha() == 0 && outer.color.alpha() == 0) {
+                    continue;
+                }
+
+                const qreal r1 = inner.position * radius;
+                const qreal r2 = outer.position * radius;
+
+                quad(center + d1 * r1, inner.color, center + d2 * r1, inner.color,
+                     center + d2 * r2, outer.color, center + d1 * r2, outer.color);
+            }
+        }
+    }
+
+    //! rectangle with the gradient applied across its thickness
+    void linearBand(const QRectF &rect, bool horizontal, const QVector<GradientStop> &stops)
+    {
+        if (rect.isEmpty()) {
+            return;
+        }
+
+        for (int s = 0; s < stops.count() - 1; ++s) {
+            const GradientStop &first = stops[s];
+            const GradientStop &last = stops[s + 1];
+
+            if (first.color.alpha() == 0 && last.color.alpha() == 0) {
+                continue;
+            }
+
+            if (horizontal) {
+                const qreal y1 = rect.top() + first.position * rect.height();
+                const qreal y2 = rect.top() + last.position * rect.height();
+                quad(QPointF(rect.left(), y1), first.color, QPointF(rect.right(), y1), first.color,
+                     QPointF(rect.right(), y2), last.color, QPointF(rect.left(), y2), last.color);
+            } else {
+                const qreal x1 = rect.left() + first.position * rect.width();
+                const qreal x2 = rect.left() + last.position * rect.width();
+                quad(QPointF(x1, rect.top()), first.color, QPointF(x1, rect.bottom()), first.color,
+                     QPointF(x2, rect.bottom()), last.color, QPointF(x2, rect.top()), last.color);
+            }
+        }
+    }
+
+private:
+    void vertex(const QPointF &point, const QColor &color)
+    {
+        const qreal alpha = color.alphaF() * m_opacity;
+        QSGGeometry::ColoredPoint2D v;
+        v.set(point.x(), point.y(),
+              static_cast<uchar>(qRound(color.redF() * alpha * 255)),
+              static_cast<uchar>(qRound(color.greenF() * alpha * 255)),
+              static_cast<uchar>(qRound(color.blueF() * alpha * 255)),
+              static_cast<uchar>(qRound(alpha * 255)));
+        m_vertices.push_back(v);
+    }
+
+    qreal m_opacity{1};
+    std::vector<QSGGeometry::ColoredPoint2D> &m_vertices;
+};
+
+QColor withAlpha(const QColor &color, qreal alpha)
+{
+    QColor result(color);
+    result.setAlphaF(qBound(0.0, alpha, 1.0));
+    return result;
+}
+
+//! formula for brightness according to https://www.w3.org/TR/AERT/#color-contrast
+qreal brightness(const QColor &color)
+{
+    return (color.red() * 299 + color.green() * 587 + color.blue() * 114) / 1000.0;
+}
+
+//! one indicator point, it follows the GlowPoint QML component
+struct PointStyle {
+    bool showGlow{false};
+    bool showAttention{false};
+    QColor basicColor;
+};
+}
+
+IndicatorsRenderer::IndicatorsRenderer(QQuickItem *parent)
+    : QQuickItem(parent)
+{
+    setFlag(ItemHasContents, true);
+    m_attentionTimer.start();
+}
+
+IndicatorsRenderer::~IndicatorsRenderer()
+{
+}
+
+QObject *IndicatorsRenderer::configuration() const
+{
+    return m_configuration;
+}
+
+void IndicatorsRenderer::setConfiguration(QObject *configuration)
+{
+    if (m_configuration == configuration) {
+        return;
+    }
+
+    if (m_configuration) {
+        disconnect(m_configuration, nullptr, this, nullptr);
+    }
+
+    m_configuration = configuration;
+
+    if (auto map = qobject_cast<QQmlPropertyMap *>(m_configuration)) {
+        connect(map, &QQmlPropertyMap::valueChanged, this, &IndicatorsRenderer::reloadConfiguration);
+    }
+
+    reloadConfiguration();
+    emit configurationChanged();
+}
+
+void IndicatorsRenderer::reloadConfiguration()
+{
+    auto map = qobject_cast<QQmlPropertyMap *>(m_configuration);
+
+    auto value = [this, map](const char *key, const QVariant &defaultValue) {
+        QVariant result;
+
+        if (map) {
+            result = map->value(QString::fromLatin1(key));
+        } else if (m_configuration) {
+            result = m_configuration->property(key);
+        }
+
+        return result.isValid() ? result : defaultValue;
+    };
+
+    Options defaults;
+
+    m_options.reversed = value("reversed", defaults.reversed).toBool();
+    m_options.extraDotOnActive = value("extraDotOnActive", defaults.extraDotOnActive).toBool();
+    m_options.minimizedTaskColoredDifferently = value("minimizedTaskColoredDifferently", defaults.minimizedTaskColoredDifferently).toBool();
+    m_options.glowEnabled = value("glowEnabled", defaults.glowEnabled).toBool();
+    m_options.glow3D = value("glow3D", defaults.glow3D).toBool();
+    m_options.activeStyle = value("activeStyle", defaults.activeStyle).toInt();
+    m_options.glowApplyTo = value("glowApplyTo", defaults.glowApplyTo).toInt();
+    m_options.size = value("size", defaults.size).toReal();
+    m_options.thickMargin = value("thickMargin", defaults.thickMargin).toReal();
+    m_options.glowOpacity = value("glowOpacity", defaults.glowOpacity).toReal();
+
+    markDirty();
+}
+
+int IndicatorsRenderer::location() const
+{
+    return m_location;
+}
+
+void IndicatorsRenderer::setLocation(int location)
+{
+    if (m_location == location) {
+        return;
+    }
+
+    m_location = location;
+    markDirty();
+    emit locationChanged();
+}
+
+int IndicatorsRenderer::iconSize() const
+{
+    return m_iconSize;
+}
+
+void IndicatorsRenderer::setIconSize(int size)
+{
+    if (m_iconSize == size) {
+        return;
+    }
+
+    m_iconSize = size;
+    markDirty();
+    emit iconSizeChanged();
+}
+
+int IndicatorsRenderer::screenEdgeMargin() const
+{
+    return m_screenEdgeMargin;
+}
+
+void IndicatorsRenderer::setScreenEdgeMargin(int margin)
+{
+    if (m_screenEdgeMargin == margin) {
+        return;
+    }
+
+    m_screenEdgeMargin = margin;
+    markDirty();
+    emit screenEdgeMarginChanged();
+}
+
+QColor IndicatorsRenderer::activeColor() const
+{
+    return m_activeColor;
+}
+
+void IndicatorsRenderer::setActiveColor(const QColor &color)
+{
+    if (m_activeColor == color) {
+        return;
+    }
+
+    m_activeColor = color;
+    markDirty();
+    emit colorsChanged();
+}
+
+QColor IndicatorsRenderer::textColor() const
+{
+    return m_textColor;
+}
+
+void IndicatorsRenderer::setTextColor(const QColor &color)
+{
+    if (m_textColor == color) {
+        return;
+    }
+
+    m_textColor = color;
+    markDirty();
+    emit colorsChanged();
+}
+
+QColor IndicatorsRenderer::attentionColor() const
+{
+    return m_attentionColor;
+}
+
+void IndicatorsRenderer::setAttentionColor(const QColor &color)
+{
+    if (m_attentionColor == color) {
+        return;
+    }
+
+    m_attentionColor = color;
+    markDirty();
+    emit colorsChanged();
+}
+
+QColor IndicatorsRenderer::contrastColor() const
+{
+    return m_contrastColor;
+}
+
+void IndicatorsRenderer::setContrastColor(const QColor &color)
+{
+    if (m_contrastColor == color) {
+        return;
+    }
+
+    m_contrastColor = color;
+    markDirty();
+    emit colorsChanged();
+}
+
+int IndicatorsRenderer::lineAnimationDuration() const
+{
+    return m_lineAnimationDuration;
+}
+
+void IndicatorsRenderer::setLineAnimationDuration(int duration)
+{
+    if (m_lineAnimationDuration == duration) {
+        return;
+    }
+
+    m_lineAnimationDuration = duration;
+    emit animationDurationsChanged();
+}
+
+int IndicatorsRenderer::attentionAnimationDuration() const
+{
+    return m_attentionAnimationDuration;
+}
+
+void IndicatorsRenderer::setAttentionAnimationDuration(int duration)
+{
+    if (m_attentionAnimationDuration == duration) {
+        return;
+    }
+
+    m_attentionAnimationDuration = duration;
+    emit animationDurationsChanged();
+}
+
+int IndicatorsRenderer::addItem(QQuickItem *item, int flags)
+{
+    if (!item) {
+        return -1;
+    }
+
+    int slot;
+
+    if (!m_freeSlots.isEmpty()) {
+        slot = m_freeSlots.takeLast();
+    } else {
+        slot = m_slots.count();
+        m_slots.append(Slot());
+    }
+
+    Slot &entry = m_slots[slot];
+    entry = Slot();
+    entry.used = true;
+    entry.item = item;
+    entry.flags = flags;
+    entry.lineProgress = hasLine(flags) ? 1 : 0;
+
+    //! removeItem() drops this connection, so the slot can not belong to another item here
+    connect(item, &QObject::destroyed, this, [this, slot]() {
+        removeItem(slot);
+    });
+
+    m_usedSlots++;
+    markDirty();
+
+    return slot;
+}
+
+void IndicatorsRenderer::removeItem(int slot)
+{
+    if (slot < 0 || slot >= m_slots.count() || !m_slots[slot].used) {
+        return;
+    }
+
+    if (m_slots[slot].item) {
+        disconnect(m_slots[slot].item, &QObject::destroyed, this, nullptr);
+    }
+
+    m_slots[slot] = Slot();
+    m_freeSlots << slot;
+    m_usedSlots--;
+    markDirty();
+}
+
+void IndicatorsRenderer::setItemFlags(int slot, int flags)
+{
+    if (slot < 0 || slot >= m_slots.count() || !m_slots[slot].used || m_slots[slot].flags == flags) {
+        return;
+    }
+
+    m_slots[slot].flags = flags;
+    markDirty();
+}
+
+bool IndicatorsRenderer::isVertical() const
+{
+    return m_location == Plasma::Types::LeftEdge || m_location == Plasma::Types::RightEdge;
+}
+
+bool IndicatorsRenderer::hasLine(int flags) const
+{
+    return m_options.activeStyle == 0 /*Line*/ && ((flags & IsActive) || (flags & HasActive));
+}
+
+qreal IndicatorsRenderer::effectiveOpacity(QQuickItem *item) const
+{
+    qreal opacity{1};
+
+    for (QQuickItem *current = item; current && current != parentItem(); current = current->parentItem()) {
+        opacity *= current->opacity();
+
+        if (opacity <= 0) {
+            return 0;
+        }
+    }
+
+    return opacity;
+}
+
+bool IndicatorsRenderer::updateSlotPlacement(Slot &slot) const
+{
+    QRectF rect;
+    qreal opacity{0};
+
+    if (slot.item && slot.item->isVisible()) {
+        rect = slot.item->mapRectToItem(this, QRectF(0, 0, slot.item->width(), slot.item->height()));
+        opacity = effectiveOpacity(slot.item);
+    }
+
+    if (slot.placed && rect == slot.rect && qFuzzyCompare(1 + opacity, 1 + slot.opacity)) {
+        return false;
+    }
+
+    slot.placed = true;
+    slot.rect = rect;
+    slot.opacity = opacity;
+    return true;
+}
+
+void IndicatorsRenderer::markDirty()
+{
+    m_dirty = true;
+    update();
+}
+
+void IndicatorsRenderer::itemChange(ItemChange change, const ItemChangeData &value)
+{
+    if (change == ItemSceneChange) {
+        setWindow(value.window);
+    }
+
+    QQuickItem::itemChange(change, value);
+}
+
+void IndicatorsRenderer::setWindow(QQuickWindow *window)
+{
+    if (m_window == window) {
+        return;
+    }
+
+    if (m_window) {
+        disconnect(m_window, &QQuickWindow::afterAnimating, this, &IndicatorsRenderer::onAfterAnimating);
+    }
+
+    m_window = window;
+
+    if (m_window) {
+        //! parabolic zoom moves the items without touching any of our properties,
+        //! their placement is checked once per frame from the gui thread
+        connect(m_window, &QQuickWindow::afterAnimating, this, &IndicatorsRenderer::onAfterAnimating);
+    }
+}
+
+void IndicatorsRenderer::onAfterAnimating()
+{
+    if (m_usedSlots == 0) {
+        return;
+    }
+
+    //! the first frame after idle advances the animations by a single frame
+    const qint64 elapsed = (m_animating && m_frameTimer.isValid()) ? m_frameTimer.restart() : 16;
+
+    if (!m_animating) {
+        m_frameTimer.start();
+    }
+
+    bool changed{false};
+    bool animating{false};
+
+    for (Slot &slot : m_slots) {
+        if (!slot.used) {
+            continue;
+        }
+
+        changed = updateSlotPlacement(slot) || changed;
+
+        const qreal target = hasLine(slot.flags) ? 1 : 0;
+
+        if (slot.lineProgress != target) {
+            if (m_lineAnimationDuration <= 0) {
+                slot.lineProgress = target;
+            } else {
+                const qreal step = static_cast<qreal>(elapsed) / m_lineAnimationDuration;
+                slot.lineProgress = target > slot.lineProgress ? qMin(target, slot.lineProgress + step) : qMax(target, slot.lineProgress - step);
+                animating = animating || (slot.lineProgress != target);
+            }
+
+            changed = true;
+        }
+
+        if ((slot.flags & InAttention) && m_attentionAnimationDuration > 0 && slot.opacity > 0) {
+            animating = true;
+            changed = true;
+        }
+    }
+
+    m_animating = animating;
+
+    if (changed) {
+        m_dirty = true;
+        update();
+    }
+}
+
+QColor IndicatorsRenderer::minimizedColor() const
+{
+    if (!m_options.minimizedTaskColoredDifferently) {
+        return m_activeColor;
+    }
+
+    return brightness(m_textColor) > 127.5 ? m_textColor.darker(170) : m_textColor.lighter(700);
+}
+
+QColor IndicatorsRenderer::attentionPulseColor(const QColor &basic) const
+{
+    if (m_attentionAnimationDuration <= 0) {
+        return m_attentionColor;
+    }
+
+    const qreal period = m_attentionAnimationDuration;
+    const qreal phase = std::fmod(static_cast<qreal>(m_attentionTimer.elapsed()), 2 * period) / period;
+    qreal progress = phase < 1 ? phase : 2 - phase;
+    //! InOutQuad
+    progress = progress < 0.5 ? 2 * progress * progress : 1 - std::pow(-2 * progress + 2, 2) / 2;
+
+    return QColor::fromRgbF(m_attentionColor.redF() + (basic.redF() - m_attentionColor.redF()) * progress,
+                            m_attentionColor.greenF() + (basic.greenF() - m_attentionColor.greenF()) * progress,
+                            m_attentionColor.blueF() + (basic.blueF() - m_attentionColor.blueF()) * progress,
+                            m_attentionColor.alphaF() + (basic.alphaF() - m_attentionColor.alphaF()) * progress);
+}
+
+QSGNode *IndicatorsRenderer::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *updatePaintNodeData)
+{
+    Q_UNUSED(updatePaintNodeData)
+
+    auto node = static_cast<QSGGeometryNode *>(oldNode);
+
+    if (m_usedSlots == 0) {
+        delete node;
+        m_dirty = false;
+        return nullptr;
+    }
+
+    if (!node) {
+        node = new QSGGeometryNode;
+        auto geometry = new QSGGeometry(QSGGeometry::defaultAttributes_ColoredPoint2D(), 0);
+        geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+        node->setGeometry(geometry);
+        node->setFlag(QSGNode::OwnsGeometry);
+        node->setMaterial(new QSGVertexColorMaterial);
+        node->setFlag(QSGNode::OwnsMaterial);
+        m_dirty = true;
+    }
+
+    if (!m_dirty) {
+        return node;
+    }
+
+    m_dirty = false;
+
+    std::vector<QSGGeometry::ColoredPoint2D> vertices;
+    VertexPainter painter(vertices);
+
+    const bool vertical = isVertical();
+    const bool horizontal = !vertical;
+    const int size = static_cast<int>(m_options.size * m_iconSize);
+    const int thickLocalMargin = static_cast<int>(m_options.thickMargin * m_iconSize);
+    const int screenEdgeMargin = (m_location == Plasma::Types::Floating || m_options.reversed) ? 0 : m_screenEdgeMargin;
+    const int thicknessMargin = screenEdgeMargin + thickLocalMargin + (m_options.glowEnabled ? 1 : 0);
+    const int glowMargins = m_options.glowEnabled ? 12 : 0;
+
+    //! the edge the indicators are anchored at, reversed indicators use the opposite one
+    Plasma::Types::Location edge = static_cast<Plasma::Types::Location>(m_location);
+
+    if (m_location == Plasma::Types::Floating) {
+        edge = Plasma::Types::BottomEdge;
+    } else if (m_options.reversed) {
+        switch (m_location) {
+        case Plasma::Types::BottomEdge: edge = Plasma::Types::TopEdge; break;
+        case Plasma::Types::TopEdge: edge = Plasma::Types::BottomEdge; break;
+        case Plasma::Types::LeftEdge: edge = Plasma::Types::RightEdge; break;
+        case Plasma::Types::RightEdge: edge = Plasma::Types::LeftEdge; break;
+        default: break;
+        }
+    }
+
+    const QColor minimized = minimizedColor();
+    const QColor contrastAlpha = withAlpha(m_contrastColor, qMin(m_options.glowOpacity + 0.25, 1.0));
+    const QColor contrastAlpha2 = withAlpha(m_contrastColor, 0.3);
+    const QColor transparent(0, 0, 0, 0);
+
+    //! it follows the GlowPoint QML component
+    auto drawPoint = [&](const QRectF &rect, const PointStyle &style) {
+        const QColor basic = style.showAttention ? attentionPulseColor(style.basicColor) : style.basicColor;
+        const QColor current = withAlpha(basic, m_options.glowOpacity);
+        const QRectF main(rect.center() - QPointF(qMax<qreal>(size, rect.width()) / 2, qMax<qreal>(size, rect.height()) / 2),
+                          QSizeF(qMax<qreal>(size, rect.width()), qMax<qreal>(size, rect.height())));
+
+        if (style.showGlow) {
+            const qreal fullCorner = 6 * size;
+            const qreal corner = fullCorner / 2;
+            const QPointF center = rect.center();
+            const qreal mainLength = qMax<qreal>(0, (horizontal ? rect.width() : rect.height()) - size);
+
+            const QVector<GradientStop> radialStops{{0.0, transparent}, {0.07, contrastAlpha}, {0.125, current}, {0.4, transparent}};
+            const QVector<GradientStop> linearStops{{0.08, transparent}, {0.37, current}, {0.43, contrastAlpha},
+                                                    {0.57, contrastAlpha}, {0.63, current}, {0.92, transparent}};
+
+            if (horizontal) {
+                painter.radialHalfDisc(QPointF(center.x() - mainLength / 2, center.y()), corner, M_PI / 2, radialStops);
+                painter.linearBand(QRectF(center.x() - mainLength / 2, center.y() - corner, mainLength, fullCorner), true, linearStops);
+                painter.radialHalfDisc(QPointF(center.x() + mainLength / 2, center.y()), corner, -M_PI / 2, radialStops);
+            } else {
+                painter.radialHalfDisc(QPointF(center.x(), center.y() - mainLength / 2), corner, M_PI, radialStops);
+                painter.linearBand(QRectF(center.x() - corner, center.y() - mainLength / 2, fullCorner, mainLength), false, linearStops);
+                painter.radialHalfDisc(QPointF(center.x(), center.y() + mainLength / 2), corner, 0, radialStops);
+            }
+        }
+
+        if (m_options.glow3D) {
+            const qreal border = qMin(2 * qMax<qreal>(1, main.width() / 5), 2 * qMax<qreal>(1, main.height() / 5));
+            painter.capsule(main.adjusted(-border / 2, -border / 2, border / 2, border / 2), contrastAlpha2);
+        }
+
+        painter.capsule(main, basic);
+
+        if (style.showGlow && m_options.glow3D) {
+            const int shadow = size / 3;
+            const qreal mainLength = qMax<qreal>(0, (horizontal ? rect.width() : rect.height()) - size);
+            const qreal length = qMax<qreal>(mainLength, shadow);
+            QPointF offset;
+
+            if (m_location == Plasma::Types::BottomEdge) {
+                offset = QPointF(0, rect.height() / 7);
+            } else if (m_location == Plasma::Types::TopEdge) {
+                offset = QPointF(0, -rect.height() / 7);
+            } else if (m_location == Plasma::Types::LeftEdge) {
+                offset = QPointF(-rect.width() / 7, 0);
+            } else if (m_location == Plasma::Types::RightEdge) {
+                offset = QPointF(rect.width() / 7, 0);
+            }
+
+            const QSizeF shadeSize = horizontal ? QSizeF(length, shadow) : QSizeF(shadow, length);
+            const QPointF shadeCenter = main.center() + offset;
+            painter.capsule(QRectF(shadeCenter - QPointF(shadeSize.width() / 2, shadeSize.height() / 2), shadeSize),
+                            withAlpha(contrastAlpha, contrastAlpha.alphaF() * 0.2));
+        }
+    };
+
+    for (Slot &slot : m_slots) {
+        if (!slot.used) {
+            continue;
+        }
+
+        updateSlotPlacement(slot);
+
+        if (slot.opacity <= 0 || slot.rect.isEmpty()) {
+            continue;
+        }
+
+        const int flags = slot.flags;
+        const qreal length = horizontal ? slot.rect.width() : slot.rect.height();
+
+        const bool secondVisible = (flags & IsGroup)
+                && ((m_options.extraDotOnActive && m_options.activeStyle == 0 /*Line*/)
+                    || m_options.activeStyle == 1 /*Dot*/
+                    || !(flags & HasActive));
+
+        const qreal secondLength = secondVisible ? size : 0;
+        const qreal spacerLength = secondVisible ? 0.5 * size : 0;
+        const qreal lineLength = ((flags & IsGroup) ? length - secondLength : length - spacerLength) - glowMargins;
+        const qreal firstLength = size + (lineLength - size) * slot.lineProgress;
+
+        qreal firstOpacity{1};
+
+        if (flags & IsEmptySpace) {
+            firstOpacity = 0;
+        } else if (flags & IsTask) {
+            firstOpacity = ((flags & IsLauncher) || (flags & InRemoving)) ? 0 : 1;
+        } else if (flags & IsApplet) {
+            firstOpacity = ((flags & IsActive) || slot.lineProgress > 0) ? 1 : 0;
+        }
+
+        const qreal total = firstLength + spacerLength + secondLength;
+        const qreal start = (length - total) / 2;
+
+        qreal across{0};
+
+        if (edge == Plasma::Types::BottomEdge) {
+            across = slot.rect.height() - thicknessMargin - size;
+        } else if (edge == Plasma::Types::TopEdge) {
+            across = thicknessMargin;
+        } else if (edge == Plasma::Types::LeftEdge) {
+            across = thicknessMargin;
+        } else {
+            across = slot.rect.width() - thicknessMargin - size;
+        }
+
+        auto pointRect = [&](qreal offset, qreal pointLength) {
+            return horizontal ? QRectF(slot.rect.left() + offset, slot.rect.top() + across, pointLength, size)
+                              : QRectF(slot.rect.left() + across, slot.rect.top() + offset, size, pointLength);
+        };
+
+        painter.setOpacity(slot.opacity);
+
+        if (firstOpacity > 0) {
+            const QColor notActive = (flags & IsMinimized) ? minimized : m_activeColor;
+
+            PointStyle first;
+            first.showAttention = (flags & InAttention);
+            first.basicColor = ((flags & IsActive) || ((flags & IsGroup) && (flags & HasShown))) ? m_activeColor : notActive;
+            first.showGlow = m_options.glowEnabled
+                    && (m_options.glowApplyTo == 2 /*All*/
+                        || first.showAttention
+                        || (m_options.glowApplyTo == 1 /*OnActive*/ && (flags & HasActive)));
+
+            drawPoint(pointRect(start, firstLength), first);
+        }
+
+        if (secondVisible) {
+            PointStyle second;
+            second.basicColor = (flags & HasMinimized) ? minimized : m_activeColor;
+            second.showGlow = m_options.glowEnabled && m_options.glowApplyTo == 2 /*All*/;
+
+            drawPoint(pointRect(start + firstLength + spacerLength, secondLength), second);
+        }
+    }
+
+    QSGGeometry *geometry = node->geometry();
+    geometry->allocate(static_cast<int>(vertices.size()));
+
+    if (!vertices.empty()) {
+        memcpy(geometry->vertexDataAsColoredPoint2D(), vertices.data(), vertices.size() * sizeof(QSGGeometry::ColoredPoint2D));
+    }
+
+    node->markDirty(QSGNode::DirtyGeometry);
+
+    return node;
+}
+
+}
@@ -0,0 +1,184 @@
+/* This file is a part of the Atmo desktop experience's SynDock project for SynOS.
+ * Copyright (C) 2026 Syndromatic Ltd. All rights reserved
+ * Designed by Kavish Krishnakumar in Manchester.
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+#ifndef LATTEINDICATORSRENDERER_H
+#define LATTEINDICATORSRENDERER_H
+
+// Qt
+#include <QColor>
+#include <QElapsedTimer>
+#include <QPointer>
+#include <QQuickItem>
+#include <QVector>
+
+// Plasma
+#include <Plasma/Plasma>
+
+namespace Latte {
+
+//! Draws the built-in indicator style for all registered items of a view in a single
+//! geometry node. Items only provide their state flags, their geometry is tracked every
+//! frame and the node is rebuilt only when anything visible changed. Indicators that are
+//! provided from QML packages are not affected and are still loaded per item.
+class IndicatorsRenderer : public QQuickItem
+{
+    Q_OBJECT
+    //! indicator configuration as provided from View::Indicator
+    Q_PROPERTY(QObject *configuration READ configuration WRITE setConfiguration NOTIFY configurationChanged)
+
+    //! Plasma::Types::Location of the view
+    Q_PROPERTY(int location READ location WRITE setLocation NOTIFY locationChanged)
+    Q_PROPERTY(int iconSize READ iconSize WRITE setIconSize NOTIFY iconSizeChanged)
+    Q_PROPERTY(int screenEdgeMargin READ screenEdgeMargin WRITE setScreenEdgeMargin NOTIFY screenEdgeMarginChanged)
+
+    Q_PROPERTY(QColor activeColor READ activeColor WRITE setActiveColor NOTIFY colorsChanged)
+    Q_PROPERTY(QColor textColor READ textColor WRITE setTextColor NOTIFY colorsChanged)
+    Q_PROPERTY(QColor attentionColor READ attentionColor WRITE setAttentionColor NOTIFY colorsChanged)
+    Q_PROPERTY(QColor contrastColor READ contrastColor WRITE setContrastColor NOTIFY colorsChanged)
+
+    //! durations in ms, 0 disables the relevant animation
+    Q_PROPERTY(int lineAnimationDuration READ lineAnimationDuration WRITE setLineAnimationDuration NOTIFY animationDurationsChanged)
+    Q_PROPERTY(int attentionAnimationDuration READ attentionAnimationDuration WRITE setAttentionAnimationDuration NOTIFY animationDurationsChanged)
+
+public:
+    enum StateFlag
+    {
+        NoState = 0,
+        IsTask = 1 << 0,
+        IsApplet = 1 << 1,
+        IsEmptySpace = 1 << 2,
+        IsLauncher = 1 << 3,
+        IsActive = 1 << 4,
+        IsGroup = 1 << 5,
+        IsMinimized = 1 << 6,
+        InAttention = 1 << 7,
+        InRemoving = 1 << 8,
+        HasActive = 1 << 9,
+        HasMinimized = 1 << 10,
+        HasShown = 1 << 11
+    };
+    Q_ENUM(StateFlag)
+
+    IndicatorsRenderer(QQuickItem *parent = nullptr);
+    ~IndicatorsRenderer() override;
+
+    QObject *configuration() const;
+    void setConfiguration(QObject *configuration);
+
+    int location() const;
+    void setLocation(int location);
+
+    int iconSize() const;
+    void setIconSize(int size);
+
+    int screenEdgeMargin() const;
+    void setScreenEdgeMargin(int margin);
+
+    QColor activeColor() const;
+    void setActiveColor(const QColor &color);
+
+    QColor textColor() const;
+    void setTextColor(const QColor &color);
+
+    QColor attentionColor() const;
+    void setAttentionColor(const QColor &color);
+
+    QColor contrastColor() const;
+    void setContrastColor(const QColor &color);
+
+    int lineAnimationDuration() const;
+    void setLineAnimationDuration(int duration);
+
+    int attentionAnimationDuration() const;
+    void setAttentionAnimationDuration(int duration);
+
+    //! registers an item whose geometry is used for its indicator, returns its slot
+    Q_INVOKABLE int addItem(QQuickItem *item, int flags);
+    Q_INVOKABLE void removeItem(int slot);
+    Q_INVOKABLE void setItemFlags(int slot, int flags);
+
+signals:
+    void animationDurationsChanged();
+    void colorsChanged();
+    void configurationChanged();
+    void iconSizeChanged();
+    void locationChanged();
+    void screenEdgeMarginChanged();
+
+protected:
+    void itemChange(ItemChange change, const ItemChangeData &value) override;
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *updatePaintNodeData) override;
+
+private slots:
+    void onAfterAnimating();
+    void reloadConfiguration();
+
+private:
+    struct Slot {
+        bool used{false};
+        bool placed{false};
+        int flags{NoState};
+        qreal opacity{0};
+        //! 0 for dot, 1 for line
+        qreal lineProgress{0};
+        QRectF rect;
+        QPointer<QQuickItem> item;
+    };
+
+    struct Options {
+        bool reversed{false};
+        bool extraDotOnActive{false};
+        bool minimizedTaskColoredDifferently{false};
+        bool glowEnabled{false};
+        bool glow3D{true};
+        int activeStyle{0};
+        int glowApplyTo{2};
+        qreal size{0.10};
+        qreal thickMargin{0};
+        qreal glowOpacity{0.35};
+    };
+
+    bool isVertical() const;
+    bool hasLine(int flags) const;
+    bool updateSlotPlacement(Slot &slot) const;
+    qreal effectiveOpacity(QQuickItem *item) const;
+    QColor minimizedColor() const;
+    QColor attentionPulseColor(const QColor &basic) const;
+
+    void markDirty();
+    void setWindow(QQuickWindow *window);
+
+private:
+    bool m_dirty{false};
+    bool m_animating{false};
+
+    int m_location{Plasma::Types::BottomEdge};
+    int m_iconSize{48};
+    int m_screenEdgeMargin{0};
+    int m_lineAnimationDuration{0};
+    int m_attentionAnimationDuration{0};
+    int m_usedSlots{0};
+
+    QColor m_activeColor{Qt::white};
+    QColor m_textColor{Qt::white};
+    QColor m_attentionColor{Qt::red};
+    QColor m_contrastColor{Qt::black};
+
+    Options m_options;
+
+    QElapsedTimer m_frameTimer;
+    QElapsedTimer m_attentionTimer;
+
+    QPointer<QObject> m_configuration;
+    QPointer<QQuickWindow> m_window;
+
+    QVector<Slot> m_slots;
+    QVector<int> m_freeSlots;
+};
+
+}
+
+#endif
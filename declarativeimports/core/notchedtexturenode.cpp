@@ -0,0 +1,202 @@
+/* This file is a part of the Atmo desktop experience's SynDock project for SynOS.
+ * Copyright (C) 2026 Syndromatic Ltd. All rights reserved
+ * Designed by Kavish Krishnakumar in Manchester.
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+#include "notchedtexturenode.h"
+
+// Qt
+#include <QSGMaterialShader>
+
+// C++
+#include <cstring>
+
+namespace Latte {
+
+namespace {
+const int MATRIXOFFSET = 0;
+const int OPACITYOFFSET = 64;
+const int UNIFORMSOFFSET = 68;
+
+class NotchedTextureShader : public QSGMaterialShader
+{
+public:
+    NotchedTextureShader()
+    {
+        setShaderFileName(VertexStage, QStringLiteral(":/org/kde/syndock/core/shaders/notchedtexture.vert.qsb"));
+        setShaderFileName(FragmentStage, QStringLiteral(":/org/kde/syndock/core/shaders/notchedtexture.frag.qsb"));
+    }
+
+    bool updateUniformData(RenderState &state, QSGMaterial *newMaterial, QSGMaterial *oldMaterial) override
+    {
+        QByteArray *buffer = state.uniformData();
+        bool changed{false};
+
+        if (state.isMatrixDirty()) {
+            const QMatrix4x4 matrix = state.combinedMatrix();
+            std::memcpy(buffer->data() + MATRIXOFFSET, matrix.constData(), 64);
+            changed = true;
+        }
+
+        if (state.isOpacityDirty()) {
+            const float opacity = state.opacity();
+            std::memcpy(buffer->data() + OPACITYOFFSET, &opacity, sizeof(float));
+            changed = true;
+        }
+
+        const auto *material = static_cast<NotchedTextureMaterial *>(newMaterial);
+        const auto *previous = static_cast<NotchedTextureMaterial *>(oldMaterial);
+
+        if (!previous || previous->uniforms() != material->uniforms()) {
+            const auto &uniforms = material->uniforms();
+            std::memcpy(buffer->data() + UNIFORMSOFFSET, uniforms.data(), uniforms.size() * sizeof(float));
+            changed = true;
+        }
+
+        return changed;
+    }
+
+    void updateSampledImage(RenderState &state, int binding, QSGTexture **texture, QSGMaterial *newMaterial, QSGMaterial *oldMaterial) override
+    {
+        Q_UNUSED(binding)
+        Q_UNUSED(oldMaterial)
+
+        QSGTexture *current = static_cast<NotchedTextureMaterial *>(newMaterial)->texture();
+
+        if (current) {
+            current->commitTextureOperations(state.rhi(), state.resourceUpdateBatch());
+        }
+
+        *texture = current;
+    }
+};
+
+void appendRect(NotchedTextureMaterial::Uniforms &uniforms, int &index, const QRectF &rect)
+{
+    uniforms[index++] = rect.x();
+    uniforms[index++] = rect.y();
+    uniforms[index++] = rect.width();
+    uniforms[index++] = rect.height();
+}
+}
+
+NotchedTextureMaterial::NotchedTextureMaterial()
+{
+    setFlag(Blending);
+}
+
+QSGMaterialType *NotchedTextureMaterial::type() const
+{
+    static QSGMaterialType type;
+    return &type;
+}
+
+QSGMaterialShader *NotchedTextureMaterial::createShader(QSGRendererInterface::RenderMode renderMode) const
+{
+    Q_UNUSED(renderMode)
+    return new NotchedTextureShader;
+}
+
+int NotchedTextureMaterial::compare(const QSGMaterial *other) const
+{
+    const auto *material = static_cast<const NotchedTextureMaterial *>(other);
+
+    if (m_texture != material->m_texture) {
+        return m_texture.data() < material->m_texture.data() ? -1 : 1;
+    }
+
+    return std::memcmp(m_uniforms.data(), material->m_uniforms.data(), m_uniforms.size() * sizeof(float));
+}
+
+QSGTexture *NotchedTextureMaterial::texture() const
+{
+    return m_texture.data();
+}
+
+void NotchedTextureMaterial::setTexture(const QSharedPointer<QSGTexture> &texture)
+{
+    m_texture = texture;
+}
+
+const NotchedTextureMaterial::Uniforms &NotchedTextureMaterial::uniforms() const
+{
+    return m_uniforms;
+}
+
+void NotchedTextureMaterial::setUniforms(const Uniforms &uniforms)
+{
+    m_uniforms = uniforms;
+}
+
+NotchedTextureNode::NotchedTextureNode()
+    : m_geometry(QSGGeometry::defaultAttributes_TexturedPoint2D(), 4)
+{
+    m_geometry.setDrawingMode(QSGGeometry::DrawTriangleStrip);
+    setGeometry(&m_geometry);
+    setMaterial(&m_material);
+}
+
+void NotchedTextureNode::setTexture(const QSharedPointer<QSGTexture> &texture)
+{
+    m_material.setTexture(texture);
+    //! the texture sub rect changes with atlas textures
+    QSGGeometry::updateTexturedRectGeometry(&m_geometry, m_rect, texture ? texture->normalizedTextureSubRect() : QRectF());
+    markDirty(DirtyMaterial | DirtyGeometry);
+}
+
+void NotchedTextureNode::setFiltering(QSGTexture::Filtering filtering)
+{
+    if (QSGTexture *texture = m_material.texture()) {
+        texture->setFiltering(filtering);
+        markDirty(DirtyMaterial);
+    }
+}
+
+void NotchedTextureNode::setRect(const QRectF &rect, const QRectF &iconRect)
+{
+    if (m_rect == rect && m_iconRect == iconRect) {
+        return;
+    }
+
+    m_rect = rect;
+    m_iconRect = iconRect;
+
+    const QSGTexture *texture = m_material.texture();
+    QSGGeometry::updateTexturedRectGeometry(&m_geometry, m_rect, texture ? texture->normalizedTextureSubRect() : QRectF());
+    markDirty(DirtyGeometry);
+
+    updateUniforms();
+}
+
+void NotchedTextureNode::setNotches(const IconNotches &notches)
+{
+    m_notches = notches;
+    updateUniforms();
+}
+
+void NotchedTextureNode::updateUniforms()
+{
+    NotchedTextureMaterial::Uniforms uniforms{};
+    int index{0};
+
+    uniforms[index++] = m_notches.progress;
+    uniforms[index++] = m_notches.radius;
+    //! std140 padding before the vec4 members
+    uniforms[index++] = 0;
+
+    appendRect(uniforms, index, m_iconRect);
+    appendRect(uniforms, index, m_notches.infoRounded);
+    appendRect(uniforms, index, m_notches.infoCorner);
+    appendRect(uniforms, index, m_notches.audioRounded);
+    appendRect(uniforms, index, m_notches.audioCorner);
+
+    if (uniforms == m_material.uniforms()) {
+        return;
+    }
+
+    m_material.setUniforms(uniforms);
+    markDirty(DirtyMaterial);
+}
+
+}
@@ -0,0 +1,87 @@
+/* This file is a part of the Atmo desktop experience's SynDock project for SynOS.
+ * Copyright (C) 2026 Syndromatic Ltd. All rights reserved
+ * Designed by Kavish Krishnakumar in Manchester.
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+#ifndef LATTENOTCHEDTEXTURENODE_H
+#define LATTENOTCHEDTEXTURENODE_H
+
+// Qt
+#include <QRectF>
+#include <QSGGeometryNode>
+#include <QSGMaterial>
+#include <QSGTexture>
+#include <QSharedPointer>
+
+// C++
+#include <array>
+
+namespace Latte {
+
+//! notch shapes in icon coordinates, the icon square is (0, 0, 1, 1). Each notch is a
+//! rounded rect with a square rect that fills its corner touching the icon corner,
+//! an empty rounded rect disables the notch
+struct IconNotches {
+    QRectF infoRounded;
+    QRectF infoCorner;
+    QRectF audioRounded;
+    QRectF audioCorner;
+    qreal radius{0.25};
+    //! 0 leaves the icon untouched and 1 cuts the notches fully
+    qreal progress{1.0};
+};
+
+class NotchedTextureMaterial : public QSGMaterial
+{
+public:
+    //! uniform block after qt_Matrix and qt_Opacity, see shaders/notchedtexture.frag
+    using Uniforms = std::array<float, 23>;
+
+    NotchedTextureMaterial();
+
+    QSGMaterialType *type() const override;
+    QSGMaterialShader *createShader(QSGRendererInterface::RenderMode renderMode) const override;
+    int compare(const QSGMaterial *other) const override;
+
+    QSGTexture *texture() const;
+    void setTexture(const QSharedPointer<QSGTexture> &texture);
+
+    const Uniforms &uniforms() const;
+    void setUniforms(const Uniforms &uniforms);
+
+private:
+    QSharedPointer<QSGTexture> m_texture;
+    Uniforms m_uniforms{};
+};
+
+//! Draws a texture as a single quad and cuts the icon badge notches in its fragment shader,
+//! so notches can follow their show/hide animation without repainting the texture
+class NotchedTextureNode : public QSGGeometryNode
+{
+public:
+    NotchedTextureNode();
+
+    void setTexture(const QSharedPointer<QSGTexture> &texture);
+    void setFiltering(QSGTexture::Filtering filtering);
+
+    //! rect is the whole texture rect in item coordinates and iconRect the icon square inside
+    //! it, the texture can extend around the icon e.g. for its shadow
+    void setRect(const QRectF &rect, const QRectF &iconRect);
+    void setNotches(const IconNotches &notches);
+
+private:
+    void updateUniforms();
+
+private:
+    QRectF m_rect;
+    QRectF m_iconRect;
+    IconNotches m_notches;
+
+    QSGGeometry m_geometry;
+    NotchedTextureMaterial m_material;
+};
+
+}
+
+#endif
@@ -0,0 +1,50 @@
+#version 440
+
+layout(location = 0) in vec2 texCoord;
+layout(location = 1) in vec2 iconCoord;
+
+layout(location = 0) out vec4 fragColor;
+
+layout(std140, binding = 0) uniform buf {
+    mat4 qt_Matrix;
+    float qt_Opacity;
+    float progress;
+    float radius;
+    vec4 iconRect;
+    vec4 infoRounded;
+    vec4 infoCorner;
+    vec4 audioRounded;
+    vec4 audioCorner;
+};
+
+layout(binding = 1) uniform sampler2D source;
+
+//! signed distance from a rect given as x, y, width, height with rounded corners
+float rectDistance(vec2 point, vec4 rect, float cornerRadius)
+{
+    vec2 halfSize = rect.zw / 2.0;
+    vec2 q = abs(point - rect.xy - halfSize) - halfSize + cornerRadius;
+    return length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - cornerRadius;
+}
+
+float notchCoverage(vec2 point, vec4 rounded, vec4 corner, float smoothing)
+{
+    if (rounded.z <= 0.0) {
+        return 0.0;
+    }
+
+    float distance = min(rectDistance(point, rounded, radius), rectDistance(point, corner, 0.0));
+    return 1.0 - smoothstep(-smoothing, smoothing, distance);
+}
+
+void main()
+{
+    //! notches touch the icon edges, clamping extends them over the shadow around the icon
+    vec2 point = clamp(iconCoord, 0.0, 1.0);
+    float smoothing = 0.5 * fwidth(iconCoord.x);
+
+    float coverage = max(notchCoverage(point, infoRounded, infoCorner, smoothing),
+                         notchCoverage(point, audioRounded, audioCorner, smoothing));
+
+    fragColor = texture(source, texCoord) * (1.0 - coverage * progress) * qt_Opacity;
+}
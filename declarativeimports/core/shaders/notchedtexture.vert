@@ -0,0 +1,29 @@
+#version 440
+
+layout(location = 0) in vec4 qt_VertexPosition;
+layout(location = 1) in vec2 qt_VertexTexCoord;
+
+layout(location = 0) out vec2 texCoord;
+layout(location = 1) out vec2 iconCoord;
+
+layout(std140, binding = 0) uniform buf {
+    mat4 qt_Matrix;
+    float qt_Opacity;
+    float progress;
+    float radius;
+    vec4 iconRect;
+    vec4 infoRounded;
+    vec4 infoCorner;
+    vec4 audioRounded;
+    vec4 audioCorner;
+};
+
+out gl_PerVertex { vec4 gl_Position; };
+
+void main()
+{
+    texCoord = qt_VertexTexCoord;
+    //! position inside the icon square, the texture may extend around it
+    iconCoord = (qt_VertexPosition.xy - iconRect.xy) / iconRect.zw;
+    gl_Position = qt_Matrix * qt_VertexPosition;
+}
@@ -16,8 +16,6 @@ import org.kde.plasma.plasmoid
 import org.kde.taskmanager as TaskManager
 import org.kde.plasma.private.taskmanager as TaskManagerApplet
 
-import org.kde.activities as Activities
-
 import org.kde.syndock.core 0.2 as LatteCore
 import org.kde.syndock.components 1.0 as LatteComponents
 
@@ -102,10 +100,13 @@ Item {
 
     property color lightTextColor: textColorBrightness > 127.5 ? themeTextColor : themeBackgroundColor
 
-    //a small badgers record (id,value)
+    //badgers record keyed by desktop file name, e.g. org.kde.konsole.desktop
     //in order to track badgers when there are changes
     //in launcher reference from libtaskmanager
-    property variant badgers:[]
+    property var badgers: ({})
+    //task items keyed by the desktop file name of their launcher,
+    //badge updates reach only the tasks they concern
+    property var badgeTargets: ({})
     property variant launchersOnActivities: []
 
     //global plasmoid reference to the context menu
@@ -490,6 +491,12 @@ Item {
     /////Window Previews/////////
 
 
+    //! libtaskmanager keeps a single refcounted window and startup source for all
+    //! tasks models of the process, this model is only the per plasmoid layer that
+    //! merges the launchers and applies the screen/activity/desktop filters and grouping.
+    //! There is intentionally no shared proxy in the plugin on top of it: it could only
+    //! wrap these same sources, and TasksModel's request/launcher/move API used all over
+    //! the task delegates would have to be reimplemented against the proxy
     TaskManager.TasksModel {
         id: tasksModel
 
@@ -554,6 +561,13 @@ Item {
         }
     }
 
+    //! provides the aggregated windows states of each task, e.g. windows count
+    //! and minimized/active windows of grouped tasks
+    LatteTasks.WindowsGroupsModel {
+        id: windowsGroupsModel
+        sourceModel: tasksModel
+    }
+
     //! TaskManagerBackend required a groupDialog setting otherwise it crashes. This patch
     //! sets one just in order not to crash TaskManagerBackend
     PlasmaCore.Dialog {
@@ -978,7 +992,7 @@ Item {
 
                 ListView {
                     id:icList
-                    model: tasksModel
+                    model: windowsGroupsModel
                     delegate: Task.TaskItem{
                         abilities: appletAbilities
                     }
@@ -1150,49 +1164,6 @@ Item {
         }
     }
 
-
-    ///REMOVE
-    ////Activities List
-    ////it can be used to cleanup the launchers from garbage-deleted activities....
-    Item{
-        id: activityModelInstance
-        property int count: activityModelRepeater.count
-
-        Repeater {
-            id:activityModelRepeater
-            model: Activities.ActivityModel {
-                id: activityModel
-                //  shownStates: "Running"
-            }
-            delegate: Item {
-                visible: false
-                property string activityId: model.id
-                property string activityName: model.name
-            }
-        }
-
-        function activities(){
-            var activitiesResult = [];
-
-            for(var i=0; i<activityModelInstance.count; ++i){
-                console.log(children[i].activityId);
-                activitiesResult.push(children[i].activityId);
-            }
-
-            return activitiesResult;
-        }
-
-        ///REMOVE
-        onCountChanged: {
-            /*  if(activityInfo.currentActivity != "00000000-0000-0000-0000-000000000000"){
-                console.log("----------- Latte Plasmoid Signal: Activities number was changed ---------");
-                var allActivities = activities();
-                ActivitiesTools.cleanupRecords(allActivities);
-                console.log("----------- Latte Plasmoid Signal End ---------");
-            }*/
-        }
-    }
-
     /////////
 
     //// functions
@@ -1206,36 +1177,75 @@ Item {
         appletAbilities.shortcuts.sglNewInstanceForEntryAtIndex(index);
     }
 
-    function getBadger(identifier) {
-        var ident1 = identifier;
-        var n = ident1.lastIndexOf('/');
+    function badgeKey(launcherUrl) {
+        var key = launcherUrl;
+        var query = key.indexOf('?');
+
+        if (query >= 0) {
+            key = key.substring(0, query);
+        }
+
+        var n = Math.max(key.lastIndexOf('/'), key.lastIndexOf(':'));
+
+        return n>=0 ? key.substring(n + 1) : key;
+    }
+
+    function addBadgeTarget(task) {
+        var key = badgeKey(task.launcherUrl);
 
-        var result = n>=0 ? ident1.substring(n + 1) : identifier;
+        if (task.badgeKey !== key) {
+            removeBadgeTarget(task);
+            task.badgeKey = key;
 
-        for(var i=0; i<badgers.length; ++i) {
-            if (result.indexOf(badgers[i].id) >= 0) {
-                return badgers[i];
+            if (key !== "") {
+                if (!badgeTargets[key]) {
+                    badgeTargets[key] = [];
+                }
+
+                badgeTargets[key].push(task);
             }
         }
+
+        var value = badgers[key];
+        task.badgeIndicator = value ? parseInt(value) : 0;
     }
 
-    function updateBadge(identifier, value) {
-        var tasks = icList.contentItem.children;
-        var identifierF = identifier.concat(".desktop");
+    function removeBadgeTarget(task) {
+        var targets = badgeTargets[task.badgeKey];
 
-        for(var i=0; i<tasks.length; ++i){
-            var task = tasks[i];
+        if (targets) {
+            var i = targets.indexOf(task);
 
-            if (task && task.launcherUrl && task.launcherUrl.indexOf(identifierF) >= 0) {
-                task.badgeIndicator = value === "" ? 0 : Number(value);
-                var badge = getBadger(identifierF);
-                if (badge) {
-                    badge.value = value;
-                } else {
-                    badgers.push({id: identifierF, value: value});
-                }
+            if (i >= 0) {
+                targets.splice(i, 1);
+            }
+
+            if (targets.length === 0) {
+                delete badgeTargets[task.badgeKey];
             }
         }
+
+        task.badgeKey = "";
+    }
+
+    function updateBadge(identifier, value) {
+        var key = identifier.concat(".desktop");
+
+        if (value === "") {
+            delete badgers[key];
+        } else {
+            badgers[key] = value;
+        }
+
+        var targets = badgeTargets[key];
+
+        if (!targets) {
+            return;
+        }
+
+        for(var i=0; i<targets.length; ++i){
+            targets[i].badgeIndicator = value === "" ? 0 : Number(value);
+        }
     }
 
     function getLauncherList() {
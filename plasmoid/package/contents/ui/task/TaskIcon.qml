@@ -11,8 +11,6 @@ import org.kde.plasma.components as PlasmaComponents
 import org.kde.plasma.plasmoid
 import org.kde.plasma.private.taskmanager as TaskManagerApplet
 
-import org.kde.kirigami as Kirigami
-
 import org.kde.syndock.core 0.2 as LatteCore
 import org.kde.syndock.components 1.0 as LatteComponents
 
@@ -31,7 +29,7 @@ Item {
     readonly property real progress: smartLauncherItem && smartLauncherItem.progress ? smartLauncherItem.progress : 0
     readonly property QtObject smartLauncherItem: smartLauncherLoader.active ? smartLauncherLoader.item : null
 
-    readonly property Item monochromizedItem: badgesLoader.active ? badgesLoader.item : taskIconItem
+    readonly property Item monochromizedItem: taskIconItem
 
     Rectangle{
         id: draggedRectangle
@@ -73,12 +71,21 @@ Item {
         }
     }
 
-    Kirigami.Icon {
+    LatteCore.IconItem {
         id: taskIconItem
         anchors.fill: parent
-        //roundToIconSize: false
         source: decoration
-        visible: !badgesLoader.active
+
+        infoNotch: badges.active && (badges.showInfo || badges.showProgress)
+        infoNotchWidth: badgeVisualsLoader.infoBadgeWidth
+        audioNotch: badges.active && badges.showAudio
+        notchesProgress: badges.activateProgress
+        notchesMirrored: (root.location === PlasmaCore.Types.RightEdge) !== (Qt.application.layoutDirection === Qt.RightToLeft && !root.vertical)
+
+        shadowSize: taskItem.abilities.myView.itemShadow.isEnabled
+                    && taskItem.abilities.environment.isGraphicsSystemAccelerated ? taskItem.abilities.myView.itemShadow.size : 0
+        shadowColor: taskItem.abilities.myView.itemShadow.shadowColor
+        tintColor: plasmoid.configuration.forceMonochromaticIcons && latteBridge ? latteBridge.palette.textColor : "transparent"
 
         readonly property real size: Math.min(width,height)
 
@@ -126,14 +133,13 @@ Item {
         ]
     }
 
-    //! Combined Loader for Progress and Audio badges masks
-    Loader{
-        id: badgesLoader
-        anchors.fill: taskIconContainer
-        active: (activateProgress > 0) && taskItem.abilities.environment.isGraphicsSystemAccelerated
-        asynchronous: true
-        opacity: stateColorizer.opacity > 0 ? 0 : 1
+    //! Progress and Audio badges state, their notches are cut natively from taskIconItem
+    //! and follow activateProgress
+    Item {
+        id: badges
+        visible: false
 
+        readonly property bool active: activateProgress > 0
         property real activateProgress: showInfo || showProgress || showAudio ? 1 : 0
 
         property bool showInfo: (root.showInfoBadge
@@ -150,145 +156,6 @@ Item {
         Behavior on activateProgress {
             NumberAnimation { duration: 2 * taskItem.abilities.animations.speedFactor.current * taskItem.abilities.animations.duration.large }
         }
-
-        sourceComponent: Item{
-            ShaderEffect {
-                id: iconOverlay
-                enabled: false
-                anchors.fill: parent
-                property var source: ShaderEffectSource {
-                    sourceItem: Kirigami.Icon{
-                        width: taskIconItem.width
-                        height: taskIconItem.height
-                        smooth: taskIconItem.smooth
-                        source: taskIconItem.source
-                        //roundToIconSize: taskIconItem.roundToIconSize
-                        active: taskIconItem.active
-
-                        Loader{
-                            anchors.fill: parent
-                            active: plasmoid.configuration.forceMonochromaticIcons
-
-                            sourceComponent: ColorOverlay {
-                                anchors.fill: parent
-                                color: latteBridge ? latteBridge.palette.textColor : "transparent"
-                                source: taskIconItem
-                            }
-                        }
-                    }
-                }
-                property var mask: ShaderEffectSource {
-                    sourceItem: Item{
-                        LayoutMirroring.enabled: Qt.application.layoutDirection === Qt.RightToLeft && !root.vertical
-                        LayoutMirroring.childrenInherit: true
-
-                        width: taskIconContainer.width
-                        height: taskIconContainer.height
-
-                        Rectangle{
-                            id: maskRect
-                            width: Math.max(badgeVisualsLoader.infoBadgeWidth, parent.width / 2)
-                            height: parent.height / 2
-                            radius: parent.height
-                            visible: badgesLoader.showInfo || badgesLoader.showProgress
-
-                            //! Removes any remainings from the icon around the roundness at the corner
-                            Rectangle{
-                                id: maskCorner
-                                width: parent.width/2
-                                height: parent.height/2
-                            }
-
-                            states: [
-                                State {
-                                    name: "default"
-                                    when: (root.location !== PlasmaCore.Types.RightEdge)
-
-                                    AnchorChanges {
-                                        target: maskRect
-                                        anchors{ top:parent.top; bottom:undefined; left:undefined; right:parent.right;}
-                                    }
-                                    AnchorChanges {
-                                        target: maskCorner
-                                        anchors{ top:parent.top; bottom:undefined; left:undefined; right:parent.right;}
-                                    }
-                                },
-                                State {
-                                    name: "right"
-                                    when: (root.location === PlasmaCore.Types.RightEdge)
-
-                                    AnchorChanges {
-                                        target: maskRect
-                                        anchors{ top:parent.top; bottom:undefined; left:parent.left; right:undefined;}
-                                    }
-                                    AnchorChanges {
-                                        target: maskCorner
-                                        anchors{ top:parent.top; bottom:undefined; left:parent.left; right:undefined;}
-                                    }
-                                }
-                            ]
-                        } // progressMask
-
-                        Rectangle{
-                            id: maskRect2
-                            width: parent.width/2
-                            height: width
-                            radius: width
-                            visible: badgesLoader.showAudio
-
-                            Rectangle{
-                                id: maskCorner2
-                                width:parent.width/2
-                                height:parent.height/2
-                            }
-
-                            states: [
-                                State {
-                                    name: "default"
-                                    when: (root.location !== PlasmaCore.Types.RightEdge)
-
-                                    AnchorChanges {
-                                        target: maskRect2
-                                        anchors{ top:parent.top; bottom:undefined; left:parent.left; right:undefined;}
-                                    }
-                                    AnchorChanges {
-                                        target: maskCorner2
-                                        anchors{ top:parent.top; bottom:undefined; left:parent.left; right:undefined;}
-                                    }
-                                },
-                                State {
-                                    name: "right"
-                                    when: (root.location === PlasmaCore.Types.RightEdge)
-
-                                    AnchorChanges {
-                                        target: maskRect2
-                                        anchors{ top:parent.top; bottom:undefined; left:undefined; right:parent.right;}
-                                    }
-                                    AnchorChanges {
-                                        target: maskCorner2
-                                        anchors{ top:parent.top; bottom:undefined; left:undefined; right:parent.right;}
-                                    }
-                                }
-                            ]
-                        } // audio mask
-                    }
-                    hideSource: true
-                    live: true
-                } //end of mask
-
-                supportsAtlasTextures: true
-
-                fragmentShader: "
-        varying highp vec2 qt_TexCoord0;
-        uniform highp float qt_Opacity;
-        uniform lowp sampler2D source;
-        uniform lowp sampler2D mask;
-        void main() {
-            gl_FragColor = texture2D(source, qt_TexCoord0.st) * (1.0 - (texture2D(mask, qt_TexCoord0.st).a)) * qt_Opacity;
-        }
-    "
-            } //end of sourceComponent
-        }
     }
     ////!
 
@@ -298,7 +165,7 @@ Item {
     Loader {
         id: badgeVisualsLoader
         anchors.fill: taskIconContainer
-        active: (badgesLoader.activateProgress > 0)
+        active: (badges.activateProgress > 0)
 
         readonly property int infoBadgeWidth: active ? publishedInfoBadgeWidth : 0
         property int publishedInfoBadgeWidth: 0
@@ -311,15 +178,15 @@ Item {
                 width: Math.max(parent.width, contentWidth)
                 height: parent.height
 
-                opacity: badgesLoader.activateProgress
-                visible: badgesLoader.showInfo || badgesLoader.showProgress
+                opacity: badges.activateProgress
+                visible: badges.showInfo || badges.showProgress
             }
 
             AudioStream{
                 id: audioStreamBadge
                 anchors.fill: parent
-                opacity: badgesLoader.activateProgress
-                visible: badgesLoader.showAudio
+                opacity: badges.activateProgress
+                visible: badges.showAudio
             }
 
             Binding {
@@ -356,10 +223,26 @@ Item {
     //! END: Badges Visuals
 
     //! Effects
+    //! the effects are applied on the icon without its baked shadow, otherwise they would
+    //! clip the shadow at the item bounds and colorize or brighten it
+    LatteCore.IconItem {
+        id: effectsIconItem
+        anchors.fill: parent
+        visible: false
+        source: taskIconItem.source
+
+        infoNotch: taskIconItem.infoNotch
+        infoNotchWidth: taskIconItem.infoNotchWidth
+        audioNotch: taskIconItem.audioNotch
+        notchesProgress: taskIconItem.notchesProgress
+        notchesMirrored: taskIconItem.notchesMirrored
+        tintColor: taskIconItem.tintColor
+    }
+
     Colorize{
         id: stateColorizer
         anchors.fill: parent
-        source: badgesLoader.active ? badgesLoader : taskIconItem
+        source: effectsIconItem
 
         opacity:0
 
@@ -379,7 +262,7 @@ Item {
         //! In Question?
         //cached: true
 
-        source: badgesLoader.active ? badgesLoader : taskIconItem
+        source: effectsIconItem
 
         opacity: taskItem.containsMouse && !clickedAnimation.running && !taskItem.abilities.indicators.info.providesHoveredAnimation ? 1 : 0
         brightness: 0.30
@@ -401,7 +284,7 @@ Item {
         //! In Question?
         //cached: true
 
-        source: badgesLoader.active ? badgesLoader : taskIconItem
+        source: effectsIconItem
 
         visible: clickedAnimation.running
     }
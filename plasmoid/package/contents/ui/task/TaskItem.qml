@@ -36,6 +36,8 @@ AbilityItem.BasicItem {
 
     isMonochromaticForcedContentItem: plasmoid.configuration.forceMonochromaticIcons
     monochromizedItem: taskIcon.monochromizedItem
+    //! shadow, monochromatic tint and badge notches are baked in taskIcon
+    contentItemBakesEffects: true
 
     isSeparatorHidden: isSeparator && (lastValidIndex > taskItem.abilities.indexer.lastVisibleItemIndex)
     isSeparatorInRealLength: isSeparator && root.dragSource
@@ -110,6 +112,7 @@ AbilityItem.BasicItem {
     property bool hasAddedWaitingLauncher: false
 
     property int badgeIndicator: 0 //it is used from external apps
+    property string badgeKey: "" //launcher desktop file name that badges are registered with
     property int lastValidIndex: -1 //used for the removal animation
     property int lastButtonClicked: -1;
     property int pressX: -1
@@ -246,8 +249,6 @@ AbilityItem.BasicItem {
 
     property QtObject contextMenu: null
 
-    signal checkWindowsStates();
-
     SubWindows{
         id: subWindows
 
@@ -342,12 +343,7 @@ AbilityItem.BasicItem {
         }
     }
 
-    onIsMinimizedChanged: {
-        checkWindowsStates();
-    }
-
     onIsActiveChanged: {
-        checkWindowsStates();
         if (isActive) {
             scrollableList.focusOn(taskItem);
         }
@@ -807,13 +803,7 @@ AbilityItem.BasicItem {
     }
 
     function updateBadge() {
-        var badger = root.getBadger(launcherUrl);
-
-        if (badger) {
-            badgeIndicator = parseInt(badger.value);
-        } else {
-            badgeIndicator = 0;
-        }
+        root.addBadgeTarget(taskItem);
     }
 
     Connections {
@@ -914,6 +904,7 @@ AbilityItem.BasicItem {
 
         showWindowAnimation.showWindow();
         updateAudioStreams();
+        updateBadge();
     }
 
     Component.onDestruction: {
@@ -926,6 +917,8 @@ AbilityItem.BasicItem {
 
         tasksExtendedManager.waitingLauncherRemoved.disconnect(slotWaitingLauncherRemoved);
 
+        root.removeBadgeTarget(taskItem);
+
         taskItem.parabolicItem.sendEndOfNeedBothAxisAnimation();
     }
 
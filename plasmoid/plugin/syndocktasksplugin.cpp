@@ -7,6 +7,7 @@
 
 // local
 #include "types.h"
+#include "windowsgroupsmodel.h"
 
 // Qt
 #include <QtQml>
@@ -16,4 +17,5 @@ void SyndockTasksPlugin::registerTypes(const char *uri)
 {
     Q_ASSERT(uri == QLatin1String("org.kde.syndock.private.tasks"));
     qmlRegisterUncreatableType<Latte::Tasks::Types>(uri, 0, 1, "Types", "SynDock Tasks Types uncreatable");
+    qmlRegisterType<Latte::Tasks::WindowsGroupsModel>(uri, 0, 1, "WindowsGroupsModel");
 }
@@ -0,0 +1,448 @@
+/* This file is a part of the Atmo desktop experience's SynDock project for SynOS.
+ * Copyright (C) 2026 Syndromatic Ltd. All rights reserved
+ * Designed by Kavish Krishnakumar in Manchester.
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "windowsgroupsmodel.h"
+
+namespace Latte {
+namespace Tasks {
+
+bool WindowsGroupsModel::GroupState::operator==(const GroupState &other) const
+{
+    return windowsCount == other.windowsCount
+            && windowsMinimized == other.windowsMinimized
+            && activeChildRow == other.activeChildRow
+            && hasActive == other.hasActive
+            && hasMinimized == other.hasMinimized
+            && hasShown == other.hasShown
+            && lastActiveWindow == other.lastActiveWindow;
+}
+
+WindowsGroupsModel::WindowsGroupsModel(QObject *parent)
+    : QIdentityProxyModel(parent)
+{
+}
+
+WindowsGroupsModel::~WindowsGroupsModel()
+{
+}
+
+void WindowsGroupsModel::setSourceModel(QAbstractItemModel *sourceModel)
+{
+    for (const auto &connection : m_sourceConnections) {
+        disconnect(connection);
+    }
+
+    m_sourceConnections.clear();
+    m_states.clear();
+
+    QIdentityProxyModel::setSourceModel(sourceModel);
+
+    updateRoleIds();
+
+    if (!sourceModel) {
+        return;
+    }
+
+    //! connected after QIdentityProxyModel so that source changes are already mapped when handled
+    m_sourceConnections << connect(sourceModel, &QAbstractItemModel::dataChanged, this, &WindowsGroupsModel::onSourceDataChanged);
+
+    m_sourceConnections << connect(sourceModel, &QAbstractItemModel::rowsInserted, this, [this](const QModelIndex &parent) {
+        onSourceRowsInserted(parent);
+    });
+
+    m_sourceConnections << connect(sourceModel, &QAbstractItemModel::rowsRemoved, this, [this](const QModelIndex &parent) {
+        onSourceRowsRemoved(parent);
+    });
+
+    m_sourceConnections << connect(sourceModel, &QAbstractItemModel::rowsMoved, this,
+                                   [this](const QModelIndex &sourceParent, int, int, const QModelIndex &destinationParent) {
+        if (sourceParent.isValid()) {
+            updateGroup(sourceParent);
+        }
+
+        if (destinationParent.isValid() && destinationParent != sourceParent) {
+            updateGroup(destinationParent);
+        }
+    });
+
+    m_sourceConnections << connect(sourceModel, &QAbstractItemModel::modelReset, this, &WindowsGroupsModel::onSourceReset);
+    m_sourceConnections << connect(sourceModel, &QAbstractItemModel::layoutChanged, this, &WindowsGroupsModel::onSourceReset);
+}
+
+void WindowsGroupsModel::updateRoleIds()
+{
+    m_isActiveRole = -1;
+    m_isMinimizedRole = -1;
+    m_isWindowRole = -1;
+    m_isLauncherRole = -1;
+    m_isStartupRole = -1;
+    m_isGroupParentRole = -1;
+    m_winIdListRole = -1;
+
+    if (!sourceModel()) {
+        return;
+    }
+
+    //! roles are resolved by name in order to not depend on libtaskmanager headers
+    const QHash<int, QByteArray> roles = sourceModel()->roleNames();
+
+    for (auto it = roles.constBegin(); it != roles.constEnd(); ++it) {
+        if (it.value() == "IsActive") {
+            m_isActiveRole = it.key();
+        } else if (it.value() == "IsMinimized") {
+            m_isMinimizedRole = it.key();
+        } else if (it.value() == "IsWindow") {
+            m_isWindowRole = it.key();
+        } else if (it.value() == "IsLauncher") {
+            m_isLauncherRole = it.key();
+        } else if (it.value() == "IsStartup") {
+            m_isStartupRole = it.key();
+        } else if (it.value() == "IsGroupParent") {
+            m_isGroupParentRole = it.key();
+        } else if (it.value() == "WinIdList") {
+            m_winIdListRole = it.key();
+        }
+    }
+}
+
+QHash<int, QByteArray> WindowsGroupsModel::roleNames() const
+{
+    QHash<int, QByteArray> roles = QIdentityProxyModel::roleNames();
+
+    roles[WindowsCount] = QByteArrayLiteral("WindowsCount");
+    roles[WindowsMinimized] = QByteArrayLiteral("WindowsMinimized");
+    roles[HasActiveWindow] = QByteArrayLiteral("HasActiveWindow");
+    roles[HasMinimizedWindow] = QByteArrayLiteral("HasMinimizedWindow");
+    roles[HasShownWindow] = QByteArrayLiteral("HasShownWindow");
+    roles[ActiveChildRow] = QByteArrayLiteral("ActiveChildRow");
+    roles[LastActiveWindow] = QByteArrayLiteral("LastActiveWindow");
+
+    return roles;
+}
+
+QVariant WindowsGroupsModel::data(const QModelIndex &index, int role) const
+{
+    if (role < WindowsCount || role > LastActiveWindow) {
+        return QIdentityProxyModel::data(index, role);
+    }
+
+    if (!index.isValid() || index.parent().isValid()) {
+        return QVariant();
+    }
+
+    const GroupState &groupState = state(mapToSource(index));
+
+    switch (role) {
+    case WindowsCount:
+        return groupState.windowsCount;
+    case WindowsMinimized:
+        return groupState.windowsMinimized;
+    case HasActiveWindow:
+        return groupState.hasActive;
+    case HasMinimizedWindow:
+        return groupState.hasMinimized;
+    case HasShownWindow:
+        return groupState.hasShown;
+    case ActiveChildRow:
+        return groupState.activeChildRow;
+    case LastActiveWindow:
+        return groupState.lastActiveWindow;
+    default:
+        break;
+    }
+
+    return QVariant();
+}
+
+bool WindowsGroupsModel::boolRole(const QModelIndex &sourceIndex, int role) const
+{
+    return role >= 0 && sourceIndex.data(role).toBool();
+}
+
+QVariant WindowsGroupsModel::firstWindowId(const QModelIndex &sourceIndex) const
+{
+    if (m_winIdListRole < 0) {
+        return QVariant();
+    }
+
+    return sourceIndex.data(m_winIdListRole).toList().value(0);
+}
+
+WindowsGroupsModel::GroupState WindowsGroupsModel::computeState(const QModelIndex &sourceTaskIndex) const
+{
+    GroupState result;
+
+    if (!sourceTaskIndex.isValid()
+            || boolRole(sourceTaskIndex, m_isLauncherRole)
+            || boolRole(sourceTaskIndex, m_isStartupRole)) {
+        return result;
+    }
+
+    if (!boolRole(sourceTaskIndex, m_isGroupParentRole)) {
+        const bool isMinimized = boolRole(sourceTaskIndex, m_isMinimizedRole);
+
+        result.windowsCount = 1;
+        result.hasActive = boolRole(sourceTaskIndex, m_isActiveRole);
+        result.hasMinimized = isMinimized;
+        result.windowsMinimized = isMinimized ? 1 : 0;
+        result.hasShown = !isMinimized && boolRole(sourceTaskIndex, m_isWindowRole);
+
+        if (result.hasActive) {
+            result.lastActiveWindow = firstWindowId(sourceTaskIndex);
+        }
+
+        return result;
+    }
+
+    const QAbstractItemModel *model = sourceTaskIndex.model();
+    result.windowsCount = model->rowCount(sourceTaskIndex);
+
+    for (int i = 0; i < result.windowsCount; ++i) {
+        const QModelIndex child = model->index(i, 0, sourceTaskIndex);
+
+        if (boolRole(child, m_isActiveRole)) {
+            result.hasActive = true;
+            result.activeChildRow = i;
+            result.lastActiveWindow = firstWindowId(child);
+        }
+
+        if (boolRole(child, m_isMinimizedRole)) {
+            result.hasMinimized = true;
+            result.windowsMinimized++;
+        } else if (boolRole(child, m_isWindowRole)) {
+            result.hasShown = true;
+        }
+    }
+
+    return result;
+}
+
+const WindowsGroupsModel::GroupState &WindowsGroupsModel::state(const QModelIndex &sourceTaskIndex) const
+{
+    const QPersistentModelIndex key(sourceTaskIndex);
+    auto it = m_states.find(key);
+
+    if (it == m_states.end()) {
+        it = m_states.insert(key, computeState(sourceTaskIndex));
+    }
+
+    return it.value();
+}
+
+void WindowsGroupsModel::updateGroup(const QModelIndex &sourceTaskIndex)
+{
+    if (!sourceTaskIndex.isValid()) {
+        return;
+    }
+
+    const QPersistentModelIndex key(sourceTaskIndex);
+    auto it = m_states.find(key);
+
+    if (it == m_states.end()) {
+        //! nobody has requested its states yet, they will be computed on demand
+        return;
+    }
+
+    GroupState updated = computeState(sourceTaskIndex);
+
+    //! the last active window is remembered even when no window of the group is active any more
+    if (!updated.lastActiveWindow.isValid() && updated.windowsCount > 0) {
+        updated.lastActiveWindow = it.value().lastActiveWindow;
+    }
+
+    if (it.value() == updated) {
+        return;
+    }
+
+    it.value() = updated;
+
+    const QModelIndex proxyIndex = mapFromSource(sourceTaskIndex);
+    emit dataChanged(proxyIndex, proxyIndex, {WindowsCount, WindowsMinimized, HasActiveWindow, HasMinimizedWindow,
+                                              HasShownWindow, ActiveChildRow, LastActiveWindow});
+}
+
+void WindowsGroupsModel::onSourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QList<int> &roles)
+{
+    if (!roles.isEmpty()
+            && !roles.contains(m_isActiveRole)
+            && !roles.contains(m_isMinimizedRole)
+            && !roles.contains(m_isWindowRole)
+            && !roles.contains(m_isLauncherRole)
+            && !roles.contains(m_isStartupRole)
+            && !roles.contains(m_isGroupParentRole)
+            && !roles.contains(m_winIdListRole)) {
+        return;
+    }
+
+    const QModelIndex parent = topLeft.parent();
+
+    if (parent.isValid()) {
+        updateGroup(parent);
+        return;
+    }
+
+    for (int row = topLeft.row(); row <= bottomRight.row(); ++row) {
+        updateGroup(sourceModel()->index(row, 0));
+    }
+}
+
+void WindowsGroupsModel::onSourceRowsInserted(const QModelIndex &parent)
+{
+    if (parent.isValid()) {
+        updateGroup(parent);
+    }
+}
+
+void WindowsGroupsModel::onSourceRowsRemoved(const QModelIndex &parent)
+{
+    if (parent.isValid()) {
+        updateGroup(parent);
+        return;
+    }
+
+    for (auto it = m_states.begin(); it != m_states.end();) {
+        if (!it.key().isValid()) {
+            it = m_states.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void WindowsGroupsModel::onSourceReset()
+{
+    m_states.clear();
+}
+
+int WindowsGroupsModel::nextChildRow(int row) const
+{
+    if (!sourceModel()) {
+        return -1;
+    }
+
+    const QModelIndex task = sourceModel()->index(row, 0);
+
+    if (!boolRole(task, m_isGroupParentRole)) {
+        return -1;
+    }
+
+    const int count = sourceModel()->rowCount(task);
+    const GroupState &groupState = state(task);
+    int next{-1};
+
+    if (groupState.activeChildRow >= 0) {
+        next = groupState.activeChildRow + 1;
+
+        //the active window is the last one
+        if (next >= count) {
+            next = 0;
+        }
+    }
+
+    if (next == -1 && groupState.lastActiveWindow.isValid()) {
+        for (int i = 0; i < count; ++i) {
+            if (firstWindowId(sourceModel()->index(i, 0, task)) == groupState.lastActiveWindow) {
+                next = i;
+                break;
+            }
+        }
+    }
+
+    return next == -1 ? 0 : next;
+}
+
+int WindowsGroupsModel::previousChildRow(int row) const
+{
+    if (!sourceModel()) {
+        return -1;
+    }
+
+    const QModelIndex task = sourceModel()->index(row, 0);
+
+    if (!boolRole(task, m_isGroupParentRole)) {
+        return -1;
+    }
+
+    const int count = sourceModel()->rowCount(task);
+    const GroupState &groupState = state(task);
+    int previous{-1};
+
+    if (groupState.activeChildRow >= 0) {
+        //the active window is the first one
+        previous = groupState.activeChildRow > 0 ? groupState.activeChildRow - 1 : count - 1;
+    }
+
+    if (previous == -1 && groupState.lastActiveWindow.isValid()) {
+        for (int i = count - 1; i >= 0; --i) {
+            if (firstWindowId(sourceModel()->index(i, 0, task)) == groupState.lastActiveWindow) {
+                previous = i;
+                break;
+            }
+        }
+    }
+
+    return previous == -1 ? 0 : previous;
+}
+
+int WindowsGroupsModel::minimizeChildRow(int row) const
+{
+    if (!sourceModel()) {
+        return -1;
+    }
+
+    const QModelIndex task = sourceModel()->index(row, 0);
+
+    if (!boolRole(task, m_isGroupParentRole)) {
+        return -1;
+    }
+
+    const int count = sourceModel()->rowCount(task);
+    const GroupState &groupState = state(task);
+
+    if (groupState.activeChildRow >= 0) {
+        return groupState.activeChildRow;
+    }
+
+    if (groupState.lastActiveWindow.isValid()) {
+        for (int i = count - 1; i >= 0; --i) {
+            const QModelIndex child = sourceModel()->index(i, 0, task);
+
+            if (firstWindowId(child) == groupState.lastActiveWindow && !boolRole(child, m_isMinimizedRole)) {
+                return i;
+            }
+        }
+    }
+
+    for (int i = count - 1; i >= 0; --i) {
+        if (!boolRole(sourceModel()->index(i, 0, task), m_isMinimizedRole)) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+QStringList WindowsGroupsModel::windowsTitles(int row) const
+{
+    QStringList titles;
+
+    if (!sourceModel()) {
+        return titles;
+    }
+
+    const QModelIndex task = sourceModel()->index(row, 0);
+    const int count = sourceModel()->rowCount(task);
+
+    for (int i = 0; i < count; ++i) {
+        titles << sourceModel()->index(i, 0, task).data(Qt::DisplayRole).toString();
+    }
+
+    return titles;
+}
+
+}
+}
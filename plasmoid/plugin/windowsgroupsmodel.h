@@ -0,0 +1,101 @@
+/* This file is a part of the Atmo desktop experience's SynDock project for SynOS.
+ * Copyright (C) 2026 Syndromatic Ltd. All rights reserved
+ * Designed by Kavish Krishnakumar in Manchester.
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#ifndef LATTETASKSWINDOWSGROUPSMODEL_H
+#define LATTETASKSWINDOWSGROUPSMODEL_H
+
+// Qt
+#include <QHash>
+#include <QIdentityProxyModel>
+#include <QPersistentModelIndex>
+#include <QVariant>
+
+namespace Latte {
+namespace Tasks {
+
+//! Identity proxy over the tasks model that adds aggregated window states for every
+//! top level task. States are updated incrementally from the source model signals and
+//! only the affected task rows are notified.
+class WindowsGroupsModel : public QIdentityProxyModel
+{
+    Q_OBJECT
+
+public:
+    enum GroupRoles
+    {
+        WindowsCount = Qt::UserRole + 2000,
+        WindowsMinimized,
+        HasActiveWindow,
+        HasMinimizedWindow,
+        HasShownWindow,
+        ActiveChildRow,
+        LastActiveWindow
+    };
+    Q_ENUM(GroupRoles);
+
+    explicit WindowsGroupsModel(QObject *parent = nullptr);
+    ~WindowsGroupsModel() override;
+
+    void setSourceModel(QAbstractItemModel *sourceModel) override;
+
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    //! child rows that should be activated/minimized when cycling through a group of windows, -1 when none
+    Q_INVOKABLE int nextChildRow(int row) const;
+    Q_INVOKABLE int previousChildRow(int row) const;
+    Q_INVOKABLE int minimizeChildRow(int row) const;
+
+    Q_INVOKABLE QStringList windowsTitles(int row) const;
+
+private slots:
+    void onSourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QList<int> &roles);
+    void onSourceRowsInserted(const QModelIndex &parent);
+    void onSourceRowsRemoved(const QModelIndex &parent);
+    void onSourceReset();
+
+private:
+    struct GroupState {
+        int windowsCount{0};
+        int windowsMinimized{0};
+        int activeChildRow{-1};
+        bool hasActive{false};
+        bool hasMinimized{false};
+        bool hasShown{false};
+        QVariant lastActiveWindow;
+
+        bool operator==(const GroupState &other) const;
+    };
+
+    void updateRoleIds();
+    void updateGroup(const QModelIndex &sourceTaskIndex);
+
+    bool boolRole(const QModelIndex &sourceIndex, int role) const;
+    QVariant firstWindowId(const QModelIndex &sourceIndex) const;
+
+    GroupState computeState(const QModelIndex &sourceTaskIndex) const;
+    const GroupState &state(const QModelIndex &sourceTaskIndex) const;
+
+private:
+    int m_isActiveRole{-1};
+    int m_isMinimizedRole{-1};
+    int m_isWindowRole{-1};
+    int m_isLauncherRole{-1};
+    int m_isStartupRole{-1};
+    int m_isGroupParentRole{-1};
+    int m_winIdListRole{-1};
+
+    QList<QMetaObject::Connection> m_sourceConnections;
+
+    //! lazily filled for top level source tasks
+    mutable QHash<QPersistentModelIndex, GroupState> m_states;
+};
+
+}
+}
+
+#endif